@@ -0,0 +1,926 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#include "../include/BlockKernels.hpp"
+#include "../include/ListBase.hpp"
+#include "../include/LruCache.hpp"
+#include "../include/MappedList.hpp"
+#include "../include/MutationLog.hpp"
+#include "../include/OrderedList.hpp"
+#include "../include/SharedList.hpp"
+#include "../include/ThreadPool.hpp"
+#include "../include/UnorderedList.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    size_t max_threads = std::max(1U, std::thread::hardware_concurrency()); /**< Largest thread count tried. */
+
+    /**
+     * @brief Run f once and return the elapsed time.
+     * @tparam F A callable without parameters.
+     * @param[in] f The code to measure.
+     * @return The elapsed time in milliseconds.
+     */
+    template<typename F>
+    double measure(F &&f) {
+        const auto start = Clock::now();
+        f();
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    /**
+     * @brief Return size pseudo-random values, the same on every run.
+     * @param[in] size The number of values.
+     * @return The values.
+     */
+    std::vector<int32_t> random_values(size_t size) {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int32_t> distribution;
+        std::vector<int32_t> values(size);
+
+        for (auto &value : values) {
+            value = distribution(generator);
+        }
+
+        return values;
+    }
+
+    /**
+     * @brief Thread counts to try: powers of two up to max_threads.
+     * @return The thread counts.
+     */
+    std::vector<size_t> thread_counts() {
+        std::vector<size_t> counts;
+
+        for (size_t threads = 1; threads < max_threads; threads *= 2) {
+            counts.push_back(threads);
+        }
+
+        counts.push_back(max_threads);
+
+        return counts;
+    }
+
+    void bench_parallel_sort(size_t size) {
+        const auto values = random_values(size);
+
+        std::cout << "parallel_sort, " << size << " nodes\n"
+                  << "threads\tms\tspeedup\n";
+
+        double base = 0;
+        for (const size_t threads : thread_counts()) {
+            std::vector<sl::Node<int32_t>> nodes(values.begin(), values.end());
+            sl::UnorderedList<int32_t> list;
+            sl::ThreadPool pool(threads);
+
+            for (auto &node : nodes) {
+                list.add_back(node);
+            }
+
+            const double ms = measure([&] { list.parallel_sort(pool); });
+            base = threads == 1 ? ms : base;
+
+            std::cout << threads << "\t" << ms << "\t" << base / ms << "\n";
+        }
+    }
+
+    void bench_parallel_load(size_t size) {
+        auto values = random_values(size);
+
+        std::cout << "OrderedList parallel create_from_array, " << size << " values\n"
+                  << "threads\tms\tspeedup\n";
+
+        double base = 0;
+        for (const size_t threads : thread_counts()) {
+            sl::ThreadPool pool(threads);
+            sl::OrderedList<int32_t> *list = nullptr;
+
+            const double ms = measure([&] {
+                list = sl::OrderedList<int32_t>::create_from_array(values.data(), size, pool);
+            });
+            base = threads == 1 ? ms : base;
+
+            std::cout << threads << "\t" << ms << "\t" << base / ms << "\n";
+
+            delete list;
+        }
+    }
+
+    void bench_parallel_apply(size_t size) {
+        const auto values = random_values(size);
+        sl::UnorderedList<int64_t> list;
+
+        for (const int32_t value : values) {
+            list.emplace_back(value);
+        }
+
+        // A few rounds of a hash mixer, so that the work per node is not
+        // negligible compared to the walk.
+        const auto mix = [](sl::Node<int64_t> &node) {
+            auto x = static_cast<uint64_t>(node.value());
+
+            for (int round = 0; round < 8; round++) {
+                x ^= x >> 33;
+                x *= 0xff51afd7ed558ccdULL;
+            }
+
+            node.value() = static_cast<int64_t>(x >> 1);
+        };
+        const auto add = [](int64_t a, int64_t b) { return a ^ b; };
+
+        const double apply_ms = measure([&] { list.apply(mix); });
+        int64_t folded = 0;
+        const double fold_ms = measure([&] { folded = list.fold(int64_t(0), add); });
+
+        std::cout << "parallel_apply and parallel_reduce, " << size << " nodes\n"
+                  << "sequential apply " << apply_ms << " ms, fold " << fold_ms << " ms (checksum " << folded << ")\n"
+                  << "threads\tapply ms\tspeedup\treduce ms\tspeedup\n";
+
+        for (const size_t threads : thread_counts()) {
+            sl::ThreadPool pool(threads);
+            int64_t checksum = 0;
+
+            const double ms = measure([&] { list.parallel_apply(pool, mix); });
+            const double reduce_ms = measure([&] { checksum = list.parallel_reduce(pool, 0, add); });
+
+            std::cout << threads << "\t" << ms << "\t" << apply_ms / ms << "\t"
+                      << reduce_ms << "\t" << fold_ms / reduce_ms << "\t(checksum " << checksum << ")\n";
+        }
+    }
+
+    void bench_lru(size_t size) {
+        // Keys drawn from a range twice the capacity, skewed towards the low
+        // keys so that the hit ratio is realistic.
+        const size_t capacity = std::max<size_t>(1, size / 10);
+        std::mt19937 generator(42);
+        std::geometric_distribution<size_t> distribution(1.0 / static_cast<double>(capacity));
+        std::vector<size_t> keys(size);
+
+        for (auto &key : keys) {
+            key = distribution(generator) % (2 * capacity);
+        }
+
+        sl::LruCache<size_t, size_t> cache(capacity);
+        size_t value = 0;
+
+        const double ms = measure([&] {
+            for (const size_t key : keys) {
+                if (!cache.get(key, value)) {
+                    cache.put(key, key);
+                }
+            }
+        });
+
+        std::cout << "LruCache, " << size << " operations, capacity " << capacity << "\n"
+                  << "ms\tMops/s\thit ratio\n"
+                  << ms << "\t" << static_cast<double>(size) / ms / 1000.0 << "\t"
+                  << static_cast<double>(cache.hits()) / static_cast<double>(size) << "\n";
+    }
+
+    /**
+     * @brief The layout of a node before the links encoded their validity:
+     * two flags next to the pointers.
+     */
+    struct FlaggedNode {
+        int64_t value; /**< The value. */
+        FlaggedNode *next; /**< The next node. */
+        FlaggedNode *prev; /**< The previous node. */
+        bool has_next; /**< True if next is valid. */
+        bool has_prev; /**< True if prev is valid. */
+    };
+
+    /**
+     * @brief Return a random permutation of the indexes from 0 to size - 1, so
+     * that the traversal order defeats the hardware prefetcher.
+     * @param[in] size The number of indexes.
+     * @return The permutation.
+     */
+    std::vector<size_t> random_order(size_t size) {
+        std::vector<size_t> order(size);
+
+        for (size_t i = 0; i < size; i++) {
+            order[i] = i;
+        }
+
+        std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+        return order;
+    }
+
+    void bench_traversal(size_t size) {
+        const auto order = random_order(size);
+        int64_t sum = 0;
+
+        std::vector<sl::Node<int64_t>> nodes(size);
+        sl::UnorderedList<int64_t> list;
+
+        for (const size_t i : order) {
+            nodes[i].value(static_cast<int64_t>(i));
+            list.add_back(nodes[i]);
+        }
+
+        const double ms = measure([&] {
+            sl::Node<int64_t> *node = &list.first();
+
+            for (size_t i = 1; i < size; i++) {
+                sum += node->value();
+                node = &node->next();
+            }
+
+            sum += node->value();
+        });
+
+        std::vector<FlaggedNode> flagged(size);
+        FlaggedNode *prev = nullptr;
+
+        for (const size_t i : order) {
+            flagged[i] = FlaggedNode{static_cast<int64_t>(i), nullptr, prev, false, prev != nullptr};
+
+            if (prev != nullptr) {
+                prev->next = &flagged[i];
+                prev->has_next = true;
+            }
+
+            prev = &flagged[i];
+        }
+
+        const double flagged_ms = measure([&] {
+            const FlaggedNode *node = &flagged[order[0]];
+
+            while (node->has_next) {
+                sum += node->value;
+                node = node->next;
+            }
+
+            sum += node->value;
+        });
+
+        std::cout << "traversal, " << size << " nodes in random order (checksum " << sum << ")\n"
+                  << "layout\tbytes\tns/node\n"
+                  << "Node\t" << sizeof(sl::Node<int64_t>) << "\t" << ms * 1e6 / static_cast<double>(size) << "\n"
+                  << "flagged\t" << sizeof(FlaggedNode) << "\t" << flagged_ms * 1e6 / static_cast<double>(size) << "\n";
+    }
+
+    /**
+     * @brief Run f once and return the elapsed time stamp counter cycles, or 0
+     * where there is no time stamp counter.
+     * @tparam F A callable without parameters.
+     * @param[in] f The code to measure.
+     * @return The elapsed cycles.
+     */
+    template<typename F>
+    double measure_cycles(F &&f) {
+#if defined(__x86_64__) || defined(__i386__)
+        const auto start = __rdtsc();
+        f();
+        return static_cast<double>(__rdtsc() - start);
+#else
+        f();
+        return 0;
+#endif
+    }
+
+    void bench_prefetch(size_t size) {
+        const auto order = random_order(size);
+        const double nodes = static_cast<double>(size);
+        int64_t sum = 0;
+
+        std::vector<sl::Node<int64_t>> storage(size);
+        sl::OrderedList<int64_t> list;
+
+        // The values grow in random memory order, so each step of a walk misses
+        // the cache once the list is larger than the last level cache. The table
+        // built on the first node makes each add a binary search, instead of a
+        // walk to the end.
+        for (size_t k = 0; k < size; k++) {
+            storage[order[k]].value(static_cast<int64_t>(2 * k));
+            list.add(storage[order[k]]);
+
+            if (k == 0) {
+                list.apply_prefetched([](sl::Node<int64_t> &) {});
+            }
+        }
+
+        const auto add = [&sum](sl::Node<int64_t> &node) { sum += node.value(); };
+
+        std::cout << "prefetch, " << size << " nodes of " << sizeof(sl::Node<int64_t>)
+                  << " bytes in random order\n"
+                  << "traversal\tcycles/node\tns/node\n";
+
+        const auto row = [nodes](const char *label, double cycles, double ms) {
+            std::cout << label << "\t" << cycles / nodes << "\t" << ms * 1e6 / nodes << "\n";
+        };
+
+        double ms = 0;
+        double cycles = measure_cycles([&] { ms = measure([&] { list.apply(add); }); });
+        row("apply", cycles, ms);
+
+        list.add(list.remove_front());
+        cycles = measure_cycles([&] { ms = measure([&] { list.apply_prefetched(add); }); });
+        row("first apply_prefetched (builds the table)", cycles, ms);
+
+        cycles = measure_cycles([&] { ms = measure([&] { list.apply_prefetched<0>(add); }); });
+        row("table, no prefetch", cycles, ms);
+
+        cycles = measure_cycles([&] { ms = measure([&] { list.apply_prefetched<4>(add); }); });
+        row("table, prefetch 4 ahead", cycles, ms);
+
+        cycles = measure_cycles([&] { ms = measure([&] { list.apply_prefetched<16>(add); }); });
+        row("table, prefetch 16 ahead", cycles, ms);
+
+        cycles = measure_cycles([&] { ms = measure([&] { list.apply_prefetched<64>(add); }); });
+        row("table, prefetch 64 ahead", cycles, ms);
+
+        // Remove and add back the same odd values, with the walk and then with
+        // the table kept by the ordered list.
+        const size_t ops = 20;
+        std::vector<sl::Node<int64_t>> extra(ops);
+
+        for (size_t i = 0; i < ops; i++) {
+            extra[i].value(static_cast<int64_t>(2 * ((i * 7919) % size) + 1));
+        }
+
+        const auto add_remove = [&] {
+            for (auto &node : extra) {
+                list.add(node);
+            }
+
+            for (auto &node : extra) {
+                sum += list.remove_value(node.value()) != nullptr;
+            }
+        };
+
+        // A change that isn't tracked by the table invalidates it.
+        list.add(list.remove_front());
+        const double walk_ms = measure(add_remove);
+
+        list.apply_prefetched(add);
+        const double table_ms = measure(add_remove);
+
+        std::cout << "ordered add + remove_value\tus/op\n"
+                  << "walk\t" << walk_ms * 1e3 / (2 * ops) << "\n"
+                  << "table\t" << table_ms * 1e3 / (2 * ops) << "\n"
+                  << "(checksum " << sum << ")\n";
+    }
+
+    /**
+     * @brief Add and remove again the nodes, size times, through the static
+     * interface of the list.
+     * @tparam Derived The concrete list.
+     * @param[in] list The list, empty.
+     * @param[in] nodes The nodes, in cache.
+     * @param[in] size The number of steps.
+     * @return The checksum of the removed values.
+     */
+    template<typename Derived>
+    int64_t churn(sl::ListBase<Derived, int64_t> &list, std::vector<sl::Node<int64_t>> &nodes, size_t size) {
+        int64_t sum = 0;
+
+        for (size_t i = 0; i < size; i++) {
+            list.push(nodes[i % nodes.size()]);
+            sum += list.pop_front().value();
+        }
+
+        return sum;
+    }
+
+    /**
+     * @brief Add and remove again the nodes, size times, through the virtual
+     * interface of the list.
+     * @param[in] list The list, empty.
+     * @param[in] nodes The nodes, in cache.
+     * @param[in] size The number of steps.
+     * @return The checksum of the removed values.
+     */
+    int64_t churn(sl::List<int64_t> &list, std::vector<sl::Node<int64_t>> &nodes, size_t size) {
+        int64_t sum = 0;
+
+        for (size_t i = 0; i < size; i++) {
+            list.add(nodes[i % nodes.size()]);
+            sum += list.remove_front().value();
+        }
+
+        return sum;
+    }
+
+    void bench_dispatch(size_t size) {
+        std::vector<sl::Node<int64_t>> nodes(16);
+        int64_t sum = 0;
+
+        for (size_t i = 0; i < nodes.size(); i++) {
+            nodes[i].value(static_cast<int64_t>(i));
+        }
+
+        sl::UnorderedList<int64_t> unordered;
+        sl::OrderedList<int64_t> ordered;
+
+        // The virtual calls go through a list picked at run time, so that the
+        // compiler can't see the dynamic type.
+        std::vector<sl::List<int64_t> *> lists{&unordered, &ordered};
+        std::shuffle(lists.begin(), lists.end(), std::mt19937(static_cast<unsigned>(size)));
+        sl::List<int64_t> &first = *lists[0];
+        sl::List<int64_t> &second = *lists[1];
+
+        // The best of a few runs, the steps are short and noisy.
+        const auto best = [](const std::function<void()> &f) {
+            double ms = measure(f);
+
+            for (int i = 0; i < 4; i++) {
+                ms = std::min(ms, measure(f));
+            }
+
+            return ms;
+        };
+
+        // push and pop_front are not virtual, so the static calls are direct
+        // whatever the compiler knows of the dynamic type.
+        sl::ListBase<sl::UnorderedList<int64_t>, int64_t> &unordered_base = unordered;
+        sl::ListBase<sl::OrderedList<int64_t>, int64_t> &ordered_base = ordered;
+        const double unordered_static = best([&] { sum += churn(unordered_base, nodes, size); });
+        const double ordered_static = best([&] { sum += churn(ordered_base, nodes, size); });
+        const double first_virtual = best([&] { sum += churn(first, nodes, size); });
+        const double second_virtual = best([&] { sum += churn(second, nodes, size); });
+
+        const bool unordered_first = &first == &unordered;
+        const double unordered_virtual = unordered_first ? first_virtual : second_virtual;
+        const double ordered_virtual = unordered_first ? second_virtual : first_virtual;
+        const double steps = static_cast<double>(size);
+
+        std::cout << "dispatch, " << size << " push + pop_front or add + remove_front on a list in cache (checksum " << sum << ")\n"
+                  << "list\tstatic ns/step\tvirtual ns/step\n"
+                  << "UnorderedList\t" << unordered_static * 1e6 / steps << "\t" << unordered_virtual * 1e6 / steps << "\n"
+                  << "OrderedList\t" << ordered_static * 1e6 / steps << "\t" << ordered_virtual * 1e6 / steps << "\n";
+    }
+
+    void bench_kernels(size_t size) {
+        sl::UnorderedList<int32_t> list;
+
+        for (const int32_t value : random_values(size)) {
+            list.emplace_back(value % 1000);
+        }
+
+        int64_t sum = 0;
+        const auto row = [](const char *label, double node_ms, double block_ms) {
+            std::cout << label << "\t" << node_ms << "\t" << block_ms << "\t" << node_ms / block_ms << "\n";
+        };
+
+        std::cout << "kernels, " << size << " int32_t values (AVX2 " << (sl::BlockKernels<int32_t>::avx2() ? "on" : "off")
+                  << ")\n"
+                  << "operation\tnode ms\tblock ms\tspeedup\n";
+
+        double node_ms = measure([&] { list.apply([](sl::Node<int32_t> &node) { node.value(node.value() * 3 + 1); }); });
+        double block_ms = measure([&] { list.transform_values([](int32_t v) { return v * 3 + 1; }); });
+        row("transform", node_ms, block_ms);
+
+        node_ms = measure([&] { sum += list.fold(int32_t(), [](int32_t a, int32_t b) { return a + b; }); });
+        block_ms = measure([&] { sum += list.sum(); });
+        row("sum", node_ms, block_ms);
+
+        node_ms = measure([&] {
+            sum += list.fold(list.first().value(), [](int32_t a, int32_t b) { return b < a ? b : a; });
+        });
+        block_ms = measure([&] { sum += list.min(); });
+        row("min", node_ms, block_ms);
+
+        node_ms = measure([&] {
+            sum += list.fold(int32_t(), [](int32_t a, int32_t b) { return a + (b > 0 ? 1 : 0); });
+        });
+        block_ms = measure([&] { sum += static_cast<int64_t>(list.count_if([](int32_t v) { return v > 0; })); });
+        row("count_if", node_ms, block_ms);
+
+        // The same with the table of jump pointers, that makes the gather a
+        // sequence of independent loads.
+        list.apply_prefetched([](sl::Node<int32_t> &) {});
+
+        node_ms = measure([&] { list.apply_prefetched([](sl::Node<int32_t> &node) { node.value(node.value() * 3 + 1); }); });
+        block_ms = measure([&] { list.transform_values([](int32_t v) { return v * 3 + 1; }); });
+        row("transform, table", node_ms, block_ms);
+
+        node_ms = measure([&] {
+            list.apply_prefetched([&sum](sl::Node<int32_t> &node) { sum += node.value(); });
+        });
+        block_ms = measure([&] { sum += list.sum(); });
+        row("sum, table", node_ms, block_ms);
+
+        std::cout << "(checksum " << sum << ")\n";
+    }
+
+    void bench_export(size_t size) {
+        sl::UnorderedList<int64_t> list;
+        list.reserve(size);
+
+        for (size_t i = 0; i < size; i++) {
+            list.emplace_back(static_cast<int64_t>(i));
+        }
+
+        int64_t sum = 0;
+        std::vector<int64_t> values;
+
+        const double apply_ms = measure([&] {
+            std::vector<int64_t> out;
+            list.apply([&out](sl::Node<int64_t> &node) { out.push_back(node.value()); });
+            sum += out.back();
+        });
+
+        const double vector_ms = measure([&] { values = list.to_vector(); });
+        const double copy_ms = measure([&] { sum += *(list.copy_values_to(values.data()) - 1); });
+
+        const double view_ms = measure([&] {
+            const auto view = list.values_view();
+
+            for (size_t i = 0; i < view.size(); i++) {
+                sum += view[i];
+            }
+        });
+
+        const double assign_ms = measure([&] { list.assign_from(values.data(), values.size()); });
+
+        std::cout << "export, " << size << " values (checksum " << sum << ")\n"
+                  << "operation\tms\n"
+                  << "apply + push_back\t" << apply_ms << "\n"
+                  << "to_vector\t" << vector_ms << "\n"
+                  << "copy_values_to\t" << copy_ms << "\n"
+                  << "values_view, layout check and sum\t" << view_ms << "\n"
+                  << "assign_from, same size\t" << assign_ms << "\n";
+    }
+
+    void bench_file(size_t size) {
+        const std::string path = "simple_list_bench.bin";
+        auto values = random_values(size);
+
+        std::unique_ptr<sl::OrderedList<int32_t>> list;
+        const double create_ms = measure([&] {
+            list.reset(sl::OrderedList<int32_t>::create_from_array(values.data(), values.size()));
+        });
+
+        const double save_ms = measure([&] { list->save(path); });
+
+        std::unique_ptr<sl::OrderedList<int32_t>> loaded;
+        const double load_ms = measure([&] { loaded.reset(sl::OrderedList<int32_t>::load(path)); });
+
+        std::remove(path.c_str());
+
+        std::cout << "file, " << size << " int32_t values (" << (loaded && loaded->size() == list->size() ? "ok" : "failed")
+                  << ")\n"
+                  << "operation\tms\n"
+                  << "OrderedList::create_from_array\t" << create_ms << "\n"
+                  << "save\t" << save_ms << "\n"
+                  << "OrderedList::load\t" << load_ms << "\n";
+    }
+
+    void bench_mapped(size_t size) {
+        const std::string path = "simple_list_bench.map";
+        std::remove(path.c_str());
+
+        std::unique_ptr<sl::MappedList<int64_t>> list(sl::MappedList<int64_t>::open(path));
+        const double add_ms = measure([&] {
+            for (size_t i = 0; i < size; i++) {
+                list->add_back(static_cast<int64_t>(i));
+            }
+        });
+
+        const double sync_ms = measure([&] { list->sync(); });
+        list.reset();
+
+        size_t reopened = 0;
+        const double open_ms = measure([&] {
+            list.reset(sl::MappedList<int64_t>::open(path));
+            reopened = list->size();
+        });
+
+        int64_t sum = 0;
+        const double apply_ms = measure([&] { list->apply([&sum](int64_t value) { sum += value; }); });
+
+        list.reset();
+        std::remove(path.c_str());
+
+        std::cout << "mapped, " << size << " values (reopened " << reopened << ", checksum " << sum << ")\n"
+                  << "operation\tms\n"
+                  << "add_back, growing the file\t" << add_ms << "\n"
+                  << "sync\t" << sync_ms << "\n"
+                  << "open again\t" << open_ms << "\n"
+                  << "apply after open\t" << apply_ms << "\n";
+    }
+
+    void bench_log(size_t size) {
+        const std::string path = "simple_list_bench.log";
+        auto values = random_values(size);
+        std::remove(path.c_str());
+
+        sl::UnorderedList<int32_t> plain;
+        const double plain_ms = measure([&] {
+            for (const int32_t value : values) {
+                plain.emplace_back(value);
+            }
+        });
+
+        sl::UnorderedList<int32_t> logged;
+        std::unique_ptr<sl::MutationLog<int32_t>> log(sl::MutationLog<int32_t>::open(path, 4096));
+        logged.log_to(log.get());
+        const double logged_ms = measure([&] {
+            for (const int32_t value : values) {
+                logged.emplace_back(value);
+            }
+
+            for (size_t i = 0; i < size / 2; i++) {
+                logged.remove_front();
+            }
+
+            log->commit();
+        });
+
+        logged.log_to(nullptr);
+        log.reset();
+
+        sl::UnorderedList<int32_t> replayed;
+        const double replay_ms = measure([&] { replayed.replay(path); });
+        std::remove(path.c_str());
+
+        const double ops = static_cast<double>(size + size / 2);
+
+        std::cout << "log, " << size << " emplace_back and " << size / 2 << " remove_front ("
+                  << (replayed.to_vector() == logged.to_vector() ? "ok" : "failed") << ")\n"
+                  << "operation\tms\tMops/s\n"
+                  << "emplace_back without log\t" << plain_ms << "\t" << static_cast<double>(size) / plain_ms / 1000 << "\n"
+                  << "logged, groups of 4096\t" << logged_ms << "\t" << ops / logged_ms / 1000 << "\n"
+                  << "replay\t" << replay_ms << "\t" << ops / replay_ms / 1000 << "\n";
+    }
+
+    void bench_shared(size_t size) {
+        const std::string name = "/simple_list_bench_" + std::to_string(getpid());
+        const size_t batch = 256;
+        const auto count = static_cast<int64_t>(size);
+        std::vector<int64_t> values(batch);
+
+        std::unique_ptr<sl::SharedList<int64_t>> list(sl::SharedList<int64_t>::create(name, 4096));
+
+        // A child process produces batches, this one consumes them in place.
+        int64_t shared_sum = 0;
+        const double shared_ms = measure([&] {
+            if (fork() == 0) {
+                std::unique_ptr<sl::SharedList<int64_t>> producer(sl::SharedList<int64_t>::open(name));
+
+                for (int64_t i = 0; i < count;) {
+                    const auto n = static_cast<size_t>(std::min<int64_t>(count - i, static_cast<int64_t>(batch)));
+                    std::iota(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(n), i);
+                    i += static_cast<int64_t>(producer->add_back(values.data(), n));
+                }
+
+                _exit(0);
+            }
+
+            for (int64_t received = 0; received < count && list->wait(5000);) {
+                received += static_cast<int64_t>(list->consume_front(batch, [&shared_sum](const int64_t &v) {
+                    shared_sum += v;
+                }));
+            }
+
+            wait(nullptr);
+        });
+
+        list.reset();
+        sl::SharedList<int64_t>::destroy(name);
+
+        // The same values copied through a pipe.
+        int64_t pipe_sum = 0;
+        int fds[2];
+        const double pipe_ms = measure([&] {
+            if (pipe(fds) != 0) {
+                return;
+            }
+
+            if (fork() == 0) {
+                close(fds[0]);
+
+                for (int64_t i = 0; i < count;) {
+                    const auto n = std::min<int64_t>(count - i, static_cast<int64_t>(batch));
+                    std::iota(values.begin(), values.begin() + n, i);
+                    i += write(fds[1], values.data(), static_cast<size_t>(n) * sizeof(int64_t)) > 0 ? n : 0;
+                }
+
+                _exit(0);
+            }
+
+            close(fds[1]);
+            std::vector<int64_t> buffer(batch);
+
+            for (ssize_t n; (n = read(fds[0], buffer.data(), batch * sizeof(int64_t))) > 0;) {
+                pipe_sum = std::accumulate(buffer.begin(), buffer.begin() + n / 8, pipe_sum);
+            }
+
+            close(fds[0]);
+            wait(nullptr);
+        });
+
+        std::cout << "shared, " << size << " int64_t values between processes in batches of " << batch << " ("
+                  << (shared_sum == pipe_sum ? "ok" : "failed") << ")\n"
+                  << "transport\tms\tMvalues/s\n"
+                  << "SharedList\t" << shared_ms << "\t" << static_cast<double>(size) / shared_ms / 1000 << "\n"
+                  << "pipe\t" << pipe_ms << "\t" << static_cast<double>(size) / pipe_ms / 1000 << "\n";
+    }
+
+    void bench_resource(size_t size) {
+        auto values = random_values(size);
+
+        std::unique_ptr<sl::UnorderedList<int32_t>> list;
+        const double heap_ms = measure([&] {
+            list.reset(sl::UnorderedList<int32_t>::create_from_array(values.data(), values.size()));
+            list.reset();
+        });
+
+        const double pool_ms = measure([&] {
+            list.reset(sl::UnorderedList<int32_t>::create_from_array(values.data(), values.size(),
+                                                                     sl::new_delete_resource()));
+            list.reset();
+        });
+
+        const double arena_ms = measure([&] {
+            sl::MonotonicBuffer arena(size * sizeof(sl::Node<int32_t>) * 2);
+            list.reset(sl::UnorderedList<int32_t>::create_from_array(values.data(), values.size(), &arena));
+            list.reset();
+        });
+
+        std::unique_ptr<sl::OrderedList<int32_t>> ordered;
+        const double ordered_heap_ms = measure([&] {
+            ordered.reset(sl::OrderedList<int32_t>::create_from_array(values.data(), values.size()));
+            ordered.reset();
+        });
+
+        const double ordered_arena_ms = measure([&] {
+            sl::MonotonicBuffer arena(size * sizeof(sl::Node<int32_t>) * 2);
+            ordered.reset(sl::OrderedList<int32_t>::create_from_array(values.data(), values.size(), &arena));
+            ordered.reset();
+        });
+
+        std::cout << "resource, create_from_array and destruction of " << size << " values\n"
+                  << "list\tresource\tms\n"
+                  << "UnorderedList\tglobal new per node\t" << heap_ms << "\n"
+                  << "UnorderedList\tnew_delete_resource pool\t" << pool_ms << "\n"
+                  << "UnorderedList\tMonotonicBuffer\t" << arena_ms << "\n"
+                  << "OrderedList\tglobal new per node\t" << ordered_heap_ms << "\n"
+                  << "OrderedList\tMonotonicBuffer\t" << ordered_arena_ms << "\n";
+    }
+
+    /**
+     * @brief Time size steps of traversals with next() of a chain of nodes that
+     * use the checking policy Check. The chain fits in the L1 cache, so the cost
+     * of the accessor is not hidden by the cache misses.
+     * @tparam Check The checking policy of the nodes.
+     * @param[in] size The number of steps.
+     * @param[in,out] sum The checksum of the values.
+     * @return The time per node in nanoseconds.
+     */
+    template<typename Check>
+    double time_checked_traversal(size_t size, int64_t &sum) {
+        const size_t length = 1024;
+        std::vector<sl::Node<int64_t, Check>> nodes(length);
+
+        for (size_t i = 0; i < length; i++) {
+            nodes[i].value(static_cast<int64_t>(i));
+            nodes[i].next(nodes[(i + 1) % length]);
+        }
+
+        const double ms = measure([&] {
+            sl::Node<int64_t, Check> *node = &nodes[0];
+
+            for (size_t i = 0; i < size; i++) {
+                sum += node->value();
+                node = &node->next();
+            }
+        });
+
+        return ms * 1e6 / static_cast<double>(size);
+    }
+
+    void bench_checks(size_t size) {
+        int64_t sum = 0;
+        const double unchecked = time_checked_traversal<sl::Unchecked>(size, sum);
+        const double asserting = time_checked_traversal<sl::Asserting>(size, sum);
+        const double throwing = time_checked_traversal<sl::Throwing>(size, sum);
+
+        std::cout << "checks, " << size << " steps on a ring of nodes in cache (checksum " << sum << ")\n"
+                  << "policy\tns/step\n"
+                  << "Unchecked\t" << unchecked << "\n"
+#ifdef NDEBUG
+                  << "Asserting\t" << asserting << " (compiled out by NDEBUG)\n"
+#else
+                  << "Asserting\t" << asserting << "\n"
+#endif
+                  << "Throwing\t" << throwing << "\n";
+    }
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::string name = argc > 1 ? argv[1] : "all";
+    const size_t size = argc > 2 ? std::stoul(argv[2]) : 1000000;
+    max_threads = argc > 3 ? std::stoul(argv[3]) : max_threads;
+
+    if (name == "all" || name == "parallel_sort") {
+        bench_parallel_sort(size);
+    }
+
+    if (name == "all" || name == "parallel_load") {
+        bench_parallel_load(size);
+    }
+
+    if (name == "all" || name == "parallel_apply") {
+        bench_parallel_apply(size);
+    }
+
+    if (name == "all" || name == "lru") {
+        bench_lru(size);
+    }
+
+    if (name == "all" || name == "traversal") {
+        bench_traversal(size);
+    }
+
+    if (name == "all" || name == "prefetch") {
+        bench_prefetch(size);
+    }
+
+    if (name == "all" || name == "dispatch") {
+        bench_dispatch(size);
+    }
+
+    if (name == "all" || name == "kernels") {
+        bench_kernels(size);
+    }
+
+    if (name == "all" || name == "export") {
+        bench_export(size);
+    }
+
+    if (name == "all" || name == "file") {
+        bench_file(size);
+    }
+
+    if (name == "all" || name == "mapped") {
+        bench_mapped(size);
+    }
+
+    if (name == "all" || name == "log") {
+        bench_log(size);
+    }
+
+    if (name == "all" || name == "shared") {
+        bench_shared(size);
+    }
+
+    if (name == "all" || name == "resource") {
+        bench_resource(size);
+    }
+
+    if (name == "all" || name == "checks") {
+        bench_checks(size);
+    }
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace simple_list {
+
+/**
+ * @brief The mutations recorded by a MutationLog.
+ */
+    enum class LogOp : uint8_t {
+        Add = 1, /**< add, with the value. */
+        AddBack, /**< add_back, with the value. */
+        AddFront, /**< add_front, with the value. */
+        RemoveFront, /**< remove_front. */
+        RemoveBack, /**< remove_back. */
+        RemoveIndex, /**< remove(index), with the index. */
+        RemoveValue /**< remove_value, with the value. */
+    };
+
+/**
+ * @brief Interface of a log of the mutations of a list. It lets a list keep an
+ * optional log without requiring trivially copyable values until a log is
+ * attached.
+ * @tparam T The type of the values.
+ */
+    template<typename T>
+    class AbstractMutationLog {
+    public:
+        /**
+         * @brief Default dtor.
+         */
+        virtual ~AbstractMutationLog() = default;
+
+        /**
+         * @brief Record a mutation with a value.
+         * @param[in] op Add, AddBack, AddFront or RemoveValue.
+         * @param[in] value The value.
+         */
+        virtual void record_value(LogOp op, const T &value) = 0;
+
+        /**
+         * @brief Record a mutation without a value.
+         * @param[in] op RemoveFront, RemoveBack or RemoveIndex.
+         * @param[in] index The index of RemoveIndex.
+         */
+        virtual void record_index(LogOp op, int32_t index) = 0;
+    };
+
+    // Defined in MutationLog.hpp, that needs the POSIX headers.
+    template<typename T>
+    class MutationLog;
+
+} // namespace simple_list
@@ -0,0 +1,189 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#if !defined(SIMPLE_LIST_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/**
+ * @brief Defined when the kernels have an AVX2 version, chosen at run time if
+ * the processor supports it. Define SIMPLE_LIST_NO_SIMD to leave only the
+ * baseline version.
+ */
+#define SIMPLE_LIST_AVX2 1
+#define SIMPLE_LIST_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+#ifdef __GNUC__
+#define SIMPLE_LIST_ALWAYS_INLINE __attribute__((always_inline)) inline
+#else
+#define SIMPLE_LIST_ALWAYS_INLINE inline
+#endif
+
+namespace simple_list {
+
+/**
+ * @brief True if the values of type T are copied into blocks and processed by
+ * the vector kernels of BlockKernels.
+ * @tparam T The type of the values.
+ */
+    template<typename T>
+    struct is_block_value
+            : std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> {
+    };
+
+/**
+ * @brief Kernels over a block of values gathered from a list. Every kernel has
+ * a baseline version, that the compiler vectorizes with the instructions always
+ * available (SSE2 on x86-64), and an AVX2 version used when the processor
+ * supports it. The reductions use a lane for each value of a 256 bits vector,
+ * so floating point sums are rounded as in a vector sum, not as in a loop.
+ * @tparam T The type of the values, arithmetic.
+ */
+    template<typename T>
+    class BlockKernels {
+    public:
+        static constexpr size_t block_size = 256; /**< Values in a block. */
+        static constexpr size_t lanes = 32 / sizeof(T) > 0 ? 32 / sizeof(T) : 1; /**< Values in a vector. */
+
+        /**
+         * @brief Replace each value of block with op of the value.
+         * @tparam UnaryOp A callable with a T param that returns T.
+         * @param[in,out] block The values.
+         * @param[in] size The number of values.
+         * @param[in] op The transformation.
+         */
+        template<typename UnaryOp>
+        static void transform(T *block, size_t size, UnaryOp &op);
+
+        /**
+         * @brief Return the sum of the values.
+         * @param[in] block The values.
+         * @param[in] size The number of values.
+         * @return The sum, zero if size is zero.
+         */
+        static T sum(const T *block, size_t size);
+
+        /**
+         * @brief Return the smallest value. NaN values give an unspecified result.
+         * @param[in] block The values.
+         * @param[in] size The number of values, not zero.
+         * @return The smallest value.
+         */
+        static T min(const T *block, size_t size);
+
+        /**
+         * @brief Return the greatest value. NaN values give an unspecified result.
+         * @param[in] block The values.
+         * @param[in] size The number of values, not zero.
+         * @return The greatest value.
+         */
+        static T max(const T *block, size_t size);
+
+        /**
+         * @brief Count the values that satisfy pred.
+         * @tparam Predicate A callable with a T param that returns bool.
+         * @param[in] block The values.
+         * @param[in] size The number of values.
+         * @param[in] pred The predicate.
+         * @return The number of values that satisfy pred.
+         */
+        template<typename Predicate>
+        static size_t count_if(const T *block, size_t size, Predicate &pred);
+
+        /**
+         * @brief Check if the AVX2 kernels are used, that is they are compiled
+         * and the processor supports them.
+         * @return True if the AVX2 kernels are used.
+         */
+        static bool avx2();
+
+    private:
+        // The portable bodies of the kernels. They are inlined in each version,
+        // so that they are compiled once for each instruction set.
+
+        template<typename UnaryOp>
+        SIMPLE_LIST_ALWAYS_INLINE static void transform_body(T *block, size_t size, UnaryOp &op);
+
+        SIMPLE_LIST_ALWAYS_INLINE static T sum_body(const T *block, size_t size);
+
+        SIMPLE_LIST_ALWAYS_INLINE static T min_body(const T *block, size_t size);
+
+        SIMPLE_LIST_ALWAYS_INLINE static T max_body(const T *block, size_t size);
+
+        template<typename Predicate>
+        SIMPLE_LIST_ALWAYS_INLINE static size_t count_if_body(const T *block, size_t size, Predicate &pred);
+
+        /**
+         * @brief Return the smallest of the lanes and of the values from from to
+         * size.
+         * @param[in] lo The smallest value of each lane.
+         * @param[in] block The values.
+         * @param[in] from The first value not in the lanes.
+         * @param[in] size The number of values.
+         * @return The smallest value.
+         */
+        SIMPLE_LIST_ALWAYS_INLINE static T finish_min(const T *lo, const T *block, size_t from, size_t size);
+
+        /**
+         * @brief Return the greatest of the lanes and of the values from from to
+         * size.
+         * @param[in] hi The greatest value of each lane.
+         * @param[in] block The values.
+         * @param[in] from The first value not in the lanes.
+         * @param[in] size The number of values.
+         * @return The greatest value.
+         */
+        SIMPLE_LIST_ALWAYS_INLINE static T finish_max(const T *hi, const T *block, size_t from, size_t size);
+
+#ifdef SIMPLE_LIST_AVX2
+
+        template<typename UnaryOp>
+        SIMPLE_LIST_TARGET_AVX2 static void transform_avx2(T *block, size_t size, UnaryOp &op);
+
+        SIMPLE_LIST_TARGET_AVX2 static T sum_avx2(const T *block, size_t size);
+
+        SIMPLE_LIST_TARGET_AVX2 static T min_avx2(const T *block, size_t size);
+
+        SIMPLE_LIST_TARGET_AVX2 static T max_avx2(const T *block, size_t size);
+
+        template<typename Predicate>
+        SIMPLE_LIST_TARGET_AVX2 static size_t count_if_avx2(const T *block, size_t size, Predicate &pred);
+
+#endif
+    };
+
+} // namespace simple_list
+
+#include "impl/BlockKernels.i.hpp"
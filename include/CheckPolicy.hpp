@@ -0,0 +1,113 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+#pragma once
+
+#include <type_traits>
+
+namespace simple_list {
+
+/**
+ * @brief Checking policy that compiles the checks out: the accessors of the
+ * nodes are single loads.
+ */
+    struct Unchecked {
+        /**
+         * @brief Do nothing.
+         * @param[in] ok The condition that must hold.
+         * @param[in] message The description of the misuse.
+         */
+        static void check(bool ok, const char *message);
+    };
+
+/**
+ * @brief Checking policy that traps misuse with assert, so it's compiled out
+ * when NDEBUG is defined.
+ */
+    struct Asserting {
+        /**
+         * @brief Assert that ok holds.
+         * @param[in] ok The condition that must hold.
+         * @param[in] message The description of the misuse.
+         */
+        static void check(bool ok, const char *message);
+    };
+
+/**
+ * @brief Checking policy that throws std::logic_error on misuse, in every
+ * build.
+ */
+    struct Throwing {
+        /**
+         * @brief Throw std::logic_error with message if ok doesn't hold.
+         * @param[in] ok The condition that must hold.
+         * @param[in] message The description of the misuse.
+         */
+        static void check(bool ok, const char *message);
+    };
+
+/**
+ * @brief The policy of the nodes that don't name one: SIMPLE_LIST_CHECK if
+ * defined, otherwise Unchecked in Release builds (NDEBUG) and Asserting in the
+ * others.
+ */
+#if defined(SIMPLE_LIST_CHECK)
+    using DefaultCheck = SIMPLE_LIST_CHECK;
+#elif defined(NDEBUG)
+    using DefaultCheck = Unchecked;
+#else
+    using DefaultCheck = Asserting;
+#endif
+
+/**
+ * @brief Tell at compile time if the checks of a policy do anything, so that
+ * a check whose condition costs more than a test can skip computing it when the
+ * policy would discard it: false for Unchecked, and for Asserting when NDEBUG
+ * is defined.
+ * @tparam Check The checking policy.
+ */
+    template<typename Check>
+    struct check_active : std::true_type {
+    };
+
+    template<>
+    struct check_active<Unchecked> : std::false_type {
+    };
+
+#if defined(NDEBUG)
+    template<>
+    struct check_active<Asserting> : std::false_type {
+    };
+#endif
+
+} // namespace simple_list
+
+#include "impl/CheckPolicy.i.hpp"
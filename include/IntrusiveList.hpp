@@ -0,0 +1,211 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+#pragma once
+
+#include "ListHook.hpp"
+#include <cstdint>
+
+namespace simple_list {
+
+/**
+ * @brief The base of the intrusive lists: the objects are not copied into
+ * nodes, they are linked through the ListHook they embed. The list never
+ * allocates and never owns the objects. The hooks form a ring closed by a
+ * sentinel, like the nodes of List, but they are ListHooks and not
+ * nodes, so the algorithms of List on nodes (sort, remove_if, partition and the
+ * visitors) are not available: apply is the only traversal.
+ *
+ * The checking policy of the hook checks that remove gets an object of this
+ * list, walking the list only when the policy is active (see check_active).
+ * @tparam T The type of the objects.
+ * @tparam Hook The hook policy, BaseHook or MemberHook.
+ */
+    template<typename T, typename Hook>
+    class IntrusiveList {
+    public:
+        /**
+         * @brief Create an empty list.
+         */
+        explicit IntrusiveList();
+
+        /**
+         * @brief Unlink all the objects, so that they can be added to other lists.
+         */
+        virtual ~IntrusiveList();
+
+        /**
+         * @brief The sentinel is bound to the address of the list, so it can't be
+         * copied.
+         * @param[in] obj The other list.
+         */
+        IntrusiveList(const IntrusiveList &obj) = delete;
+
+        /**
+         * @brief The sentinel is bound to the address of the list, so it can't be
+         * assigned.
+         * @param[in] obj The other list.
+         * @return The current list.
+         */
+        IntrusiveList &operator=(const IntrusiveList &obj) = delete;
+
+        /**
+         * @brief Return the number of objects in the list.
+         * @return Number of objects in the list.
+         */
+        int32_t size() const;
+
+        /**
+         * @brief Check if the list is empty.
+         * @return true if the list is empty, false otherwise.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Return the first object of the list. If the list is empty an
+         * error occurs.
+         * @return The first object of the list.
+         */
+        T &first();
+
+        /**
+         * @brief Return the last object of the list. If the list is empty an error
+         * occurs.
+         * @return The last object of the list.
+         */
+        T &last();
+
+        /**
+         * @brief Add an object to the list. If the hook is already linked an error
+         * occurs.
+         * @param[in] value The object to insert.
+         */
+        virtual void add(T &value) = 0;
+
+        /**
+         * @brief Remove an object of the list in O(1), or in O(n) when the policy
+         * is active and checks that it's in this list.
+         * @param[in] value An object of the list.
+         */
+        void remove(T &value);
+
+        /**
+         * @brief Remove the first object of the list in O(1).
+         * @return The removed object.
+         */
+        T &remove_front();
+
+        /**
+         * @brief Remove the last object of the list in O(1).
+         * @return The removed object.
+         */
+        T &remove_back();
+
+        /**
+         * @brief Check if the hook of value is linked to a list.
+         * @param[in] value An object.
+         * @return True if value is in a list with this hook, false otherwise.
+         */
+        static bool linked(const T &value);
+
+        /**
+         * @brief Apply function to all the objects in the list, from the first.
+         * @tparam Function A callable with a T& param.
+         * @param[in] function The function to apply.
+         */
+        template<typename Function>
+        void apply(Function function);
+
+    protected:
+        using Link = typename Hook::hook_type; /**< The hooks, the sentinel is one too. */
+        using Check = typename Hook::hook_type::check_type; /**< The checking policy. */
+
+        /**
+         * @brief Return the links of the hook of value.
+         * @param[in] value An object.
+         * @return The links of the object.
+         */
+        static Link &link_of(T &value);
+
+        /**
+         * @brief Return the object that contains link.
+         * @param[in] link The links of an object, not the sentinel.
+         * @return The object.
+         */
+        static T &value_of(Link *link);
+
+        /**
+         * @brief Link value before pos, that can be the sentinel. If the hook is
+         * already linked an error occurs.
+         * @param[in] pos An object of the list or the sentinel.
+         * @param[in] value The object to insert.
+         */
+        void insert(Link &pos, T &value);
+
+        /**
+         * @brief Return the hook of the first object of the list, or the sentinel
+         * if the list is empty.
+         * @return The position before the first object.
+         */
+        Link &front_link();
+
+        /**
+         * @brief Return the hook of the first object for which before holds, or
+         * the sentinel if none: the position of an ordered insert.
+         * @tparam Predicate A callable with a T& param that returns bool.
+         * @param[in] before The predicate.
+         * @return The first object that satisfies before, or the sentinel.
+         */
+        template<typename Predicate>
+        Link &find_if(Predicate before);
+
+        int32_t _size{0}; /**<  Number of objects */
+        Link _sentinel; /**<  Both the head and the tail of the list */
+
+    private:
+        /**
+         * @brief Check if value is linked in this list, walking it.
+         * @param[in] value An object.
+         * @return True if value is in this list, false otherwise.
+         */
+        bool contains(const T &value) const;
+
+        /**
+         * @brief Unlink value, that must be an object of this list, without
+         * checking it.
+         * @param[in] value An object of the list.
+         */
+        void unlink(T &value);
+    };
+
+} // namespace simple_list
+
+#include "impl/IntrusiveList.i.hpp"
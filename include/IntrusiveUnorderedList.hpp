@@ -0,0 +1,79 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+#pragma once
+
+#include "IntrusiveList.hpp"
+
+namespace simple_list {
+
+/**
+ * @brief A double linked list of objects that embed a ListHook.
+ * @tparam T The type of the objects.
+ * @tparam Hook The hook policy, BaseHook (default) or MemberHook.
+ */
+    template<typename T, typename Hook = BaseHook<T>>
+    class IntrusiveUnorderedList : public IntrusiveList<T, Hook> {
+    public:
+        /**
+         * @brief Default ctor
+         */
+        explicit IntrusiveUnorderedList() = default;
+
+        /**
+         * @brief Default dtor.
+         */
+        ~IntrusiveUnorderedList() override = default;
+
+        void add(T &value) override;
+
+        /**
+         * @brief Add an object to the back of the list.
+         * @param[in] value The object to insert.
+         */
+        void add_back(T &value);
+
+        /**
+         * @brief Add an object to the front of the list.
+         * @param[in] value The object to insert.
+         */
+        void add_front(T &value);
+
+        /**
+         * @brief Move an object of the list to the front in O(1).
+         * @param[in] value An object of the list.
+         */
+        void move_to_front(T &value);
+    };
+
+} // namespace simple_list
+
+#include "impl/IntrusiveUnorderedList.i.hpp"
@@ -32,22 +32,53 @@
 
 #pragma once
 
+#include "AbstractMutationLog.hpp"
+#include "ListIterator.hpp"
 #include "Node.hpp"
+#include "NodePool.hpp"
 #include "SentinelNode.hpp"
+#include "ValueView.hpp"
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace simple_list {
 
+    template<typename T>
+    struct is_block_value;
+
+    template<typename T>
+    class BlockKernels;
+
+    template<typename T>
+    class ListFile;
+
 /**
  * @brief A generic double linked list implementation.
+ *
+ * This header doesn't include the optional parts, so that a list doesn't pull
+ * in the thread and POSIX headers: the block kernels (transform_values, sum,
+ * min, max, count_if) need BlockKernels.hpp, save and load need ListFile.hpp,
+ * replay needs MutationLog.hpp and the parallel members a ThreadPool.
  * @tparam T Type of the list.
  */
     template<typename T>
     class List {
     public:
+        using iterator = ListIterator<T, T>; /**< Mutable iterator on the values. */
+        using const_iterator = ListIterator<T, const T>; /**< Constant iterator on the values. */
+        using reverse_iterator = std::reverse_iterator<iterator>; /**< Mutable reverse iterator. */
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>; /**< Constant reverse iterator. */
+
         /**
-         * @brief Default dtor.
+         * @brief Destroy the list. If the list has been created with
+         * create_from_array also the nodes are deleted. The nodes created by
+         * emplace are destroyed with the pool of the list.
          */
-        virtual ~List<T>() = default;
+        virtual ~List<T>();
 
         /**
          * @brief Return the number of elements stored in the list
@@ -75,6 +106,67 @@ namespace simple_list {
          */
         Node<T> &last();
 
+        /**
+         * @brief Return an iterator to the first value. In an OrderedList the
+         * values must not be modified in a way that changes their order.
+         * @return The iterator to the first value, end() if the list is empty.
+         */
+        iterator begin();
+
+        /**
+         * @brief Return a constant iterator to the first value.
+         * @return The iterator to the first value, end() if the list is empty.
+         */
+        const_iterator begin() const;
+
+        /**
+         * @brief Return a constant iterator to the first value.
+         * @return The iterator to the first value, cend() if the list is empty.
+         */
+        const_iterator cbegin() const;
+
+        /**
+         * @brief Return the iterator past the last value, that is the sentinel.
+         * @return The end iterator.
+         */
+        iterator end();
+
+        /**
+         * @brief Return the constant iterator past the last value.
+         * @return The end iterator.
+         */
+        const_iterator end() const;
+
+        /**
+         * @brief Return the constant iterator past the last value.
+         * @return The end iterator.
+         */
+        const_iterator cend() const;
+
+        /**
+         * @brief Return a reverse iterator to the last value.
+         * @return The reverse iterator to the last value.
+         */
+        reverse_iterator rbegin();
+
+        /**
+         * @brief Return a constant reverse iterator to the last value.
+         * @return The reverse iterator to the last value.
+         */
+        const_reverse_iterator rbegin() const;
+
+        /**
+         * @brief Return the reverse iterator before the first value.
+         * @return The reverse end iterator.
+         */
+        reverse_iterator rend();
+
+        /**
+         * @brief Return the constant reverse iterator before the first value.
+         * @return The reverse end iterator.
+         */
+        const_reverse_iterator rend() const;
+
         /**
          * @brief Add a node to the list.
          * @param[in] node The node to insert.
@@ -88,39 +180,349 @@ namespace simple_list {
         virtual Node<T> &remove_front() = 0;
 
         /**
-         * @brief Apply the function lambda to all nodes in the list.
-         * @param[in] lambda A function with a Node<T>& param and returns void.
+         * @brief Apply function to all nodes in the list, from the first. The
+         * function may unlink the node it receives.
+         * @tparam Function A callable with a Node<T>& param.
+         * @param[in] function The function to apply, it can keep a state.
+         */
+        template<typename Function>
+        void apply(Function &&function);
+
+        /**
+         * @brief Apply function to the nodes in the list, from the first, until it
+         * returns true.
+         * @tparam Function A callable with a Node<T>& param that returns bool.
+         * @param[in] function The function to apply.
+         * @return The node where function returned true, nullptr if it never did.
+         */
+        template<typename Function>
+        Node<T> *for_each_until(Function &&function);
+
+        /**
+         * @brief Return the first node whose value satisfies pred.
+         * @tparam Predicate A callable with a const T& param that returns bool.
+         * @param[in] pred The predicate.
+         * @return The first node that satisfies pred, nullptr if none does.
+         */
+        template<typename Predicate>
+        Node<T> *find_if(Predicate &&pred);
+
+        /**
+         * @brief Check if the value of a node satisfies pred, stopping at the first.
+         * @tparam Predicate A callable with a const T& param that returns bool.
+         * @param[in] pred The predicate.
+         * @return True if a value satisfies pred, false otherwise.
+         */
+        template<typename Predicate>
+        bool any_of(Predicate &&pred);
+
+        /**
+         * @brief Combine the values from the first with op, starting from init.
+         * @tparam Acc The type of the result.
+         * @tparam BinaryOp A callable with an Acc and a const T& param that returns
+         * the new Acc.
+         * @param[in] init The initial value.
+         * @param[in] op The combining function.
+         * @return The combination of all the values.
+         */
+        template<typename Acc, typename BinaryOp>
+        Acc fold(Acc init, BinaryOp &&op);
+
+        /**
+         * @brief Apply function to all nodes in the list, from the first, like
+         * apply, while prefetching the node Distance positions ahead. The nodes
+         * are taken from a table of jump pointers in list order, so the loads
+         * don't depend on each other. The table is built by the first call, that
+         * is a plain walk, and is kept until the links change.
+         * @tparam Distance How many nodes ahead are prefetched.
+         * @tparam Function A callable with a Node<T>& param.
+         * @param[in] function The function to apply, it can keep a state.
+         */
+        template<size_t Distance = 16, typename Function>
+        void apply_prefetched(Function &&function);
+
+        /**
+         * @brief Return the sum of the values, computed in blocks by a vector
+         * kernel. T must be arithmetic.
+         * @return The sum, zero if the list is empty.
+         */
+        T sum();
+
+        /**
+         * @brief Return the smallest value, computed in blocks by a vector
+         * kernel. T must be arithmetic. If the list is empty an error occurs.
+         * @return The smallest value.
+         */
+        T min();
+
+        /**
+         * @brief Return the greatest value, computed in blocks by a vector
+         * kernel. T must be arithmetic. If the list is empty an error occurs.
+         * @return The greatest value.
+         */
+        T max();
+
+        /**
+         * @brief Count the values that satisfy pred, computed in blocks by a
+         * vector kernel. T must be arithmetic.
+         * @tparam Predicate A callable with a T param that returns bool.
+         * @param[in] pred The predicate.
+         * @return The number of values that satisfy pred.
+         */
+        template<typename Predicate>
+        size_t count_if(Predicate &&pred);
+
+        /**
+         * @brief Copy the values, in list order, to out.
+         * @param[out] out The destination, with room for size() values.
+         * @return The end of the values copied.
+         */
+        T *copy_values_to(T *out) const;
+
+        /**
+         * @brief Return a vector with the values in list order.
+         * @return The values.
+         */
+        std::vector<T> to_vector() const;
+
+        /**
+         * @brief Return a view of the values without copying them. The nodes must
+         * be one after another in memory in list order, as the nodes created by
+         * emplace_back after a reserve, otherwise the view is empty. Checking
+         * the layout walks the list once.
+         * @return The view of all the values, or an empty view.
+         */
+        ValueView<T, T> values_view();
+
+        /**
+         * @brief Return a constant view of the values without copying them. The
+         * nodes must be one after another in memory in list order, otherwise the
+         * view is empty. Checking the layout walks the list once.
+         * @return The view of all the values, or an empty view.
+         */
+        ValueView<T, const T> values_view() const;
+
+        /**
+         * @brief Make room in the pool of the list for count nodes, so that the
+         * next count nodes created by emplace are one after another in memory.
+         * @param[in] count The number of nodes.
+         */
+        void reserve(size_t count);
+
+        /**
+         * @brief Return the resource of the nodes created by emplace and reserve.
+         * @return The resource, new_delete_resource() unless the list has been
+         * created with another one.
          */
-        void apply(void (*lambda)(Node<T> &node));
+        MemoryResource *resource() const;
+
+        /**
+         * @brief Save the values, in list order, to the file path in the binary
+         * format of ListFile. T must be trivially copyable. If the file can't be
+         * written an error occurs.
+         * @param[in] path The path of the file, overwritten.
+         * @return True if the list has been saved, false otherwise.
+         */
+        bool save(const std::string &path) const;
+
+        /**
+         * @brief Record the next add, add_back, add_front, remove_front,
+         * remove_back, remove and remove_value in log, so that replay can redo
+         * them. The other changes, like sort, splice or extract_if, are not
+         * recorded: save the list after them and start a new log. The list
+         * doesn't own the log.
+         * @param[in] log The log, or nullptr to stop recording.
+         */
+        void log_to(AbstractMutationLog<T> *log);
+
+        /**
+         * @brief Apply function to all nodes in the list on the workers of pool.
+         * The list is cut in segments of roughly equal length while it is
+         * walked, so the workers start before the walk ends. The first nodes of
+         * the segments are kept for the next parallel calls, until the links
+         * change. The function must not change the links and must be safe to
+         * call concurrently on different nodes. It waits for the segments, so it
+         * deadlocks if called from a task of pool.
+         * @tparam Pool ThreadPool, or a pool with the same size and submit.
+         * @tparam Function A callable with a Node<T>& param.
+         * @param[in] pool The pool that runs the segments.
+         * @param[in] function The function to apply.
+         */
+        template<typename Pool, typename Function>
+        void parallel_apply(Pool &pool, Function &&function);
+
+        /**
+         * @brief Combine init and all the values with op on the workers of pool.
+         * Each segment is combined from its first value and the partial results
+         * are combined in list order, so op must be associative but need not be
+         * commutative. Like parallel_apply, it must not be called from a task of
+         * pool.
+         * @tparam Pool ThreadPool, or a pool with the same size and submit.
+         * @tparam BinaryOp A callable with two const T& params that returns T.
+         * @param[in] pool The pool that runs the segments.
+         * @param[in] init The initial value.
+         * @param[in] op The combining function.
+         * @return The combination of init and all the values.
+         */
+        template<typename Pool, typename BinaryOp>
+        T parallel_reduce(Pool &pool, T init, BinaryOp &&op);
 
     protected:
         /**
-         * @brief Return the head of the list.
-         * @return The head of the list.
+         * @brief Replace each value with op of the value. The values are copied
+         * in blocks, transformed by a vector kernel and copied back, so op must
+         * not depend on the nodes. T must be arithmetic. It's protected because
+         * it doesn't keep an order: the lists that don't keep one make it
+         * public.
+         * @tparam UnaryOp A callable with a T param that returns T.
+         * @param[in] op The transformation.
+         */
+        template<typename UnaryOp>
+        void transform_values(UnaryOp &&op);
+
+        /**
+         * @brief Return the sentinel that closes the ring of the nodes.
+         * @return The sentinel of the list.
+         */
+        SentinelNode<T> &sentinel();
+
+        /**
+         * @brief Link the chain that goes from first to last before pos, that can
+         * be the sentinel. The size is not updated.
+         * @param[in] pos A node of the list or the sentinel.
+         * @param[in] first The first node of the chain.
+         * @param[in] last The last node of the chain.
+         */
+        void splice(NodeBase<T> &pos, Node<T> &first, Node<T> &last);
+
+        /**
+         * @brief Take all the nodes out of the ring as a chain terminated by null
+         * links and leave the sentinel empty. The size is not updated. The list
+         * must not be empty.
+         * @param[out] first The first node of the chain.
+         * @param[out] last The last node of the chain.
+         */
+        void release(Node<T> *&first, Node<T> *&last);
+
+        /**
+         * @brief Check if the table of jump pointers built by apply_prefetched is
+         * still valid, that is the links didn't change since it was built. The
+         * lists that keep the table valid on their own changes update _jumps and
+         * _jumps_version.
+         * @return True if _jumps holds all the nodes in list order.
+         */
+        bool jumps_valid() const;
+
+        /**
+         * @brief Hint the processor to load the cache line of address.
+         * @param[in] address The address that will be read soon.
+         */
+        static void prefetch(const void *address);
+
+        /**
+         * @brief Add to the back of the list the values saved in the file path.
+         * The nodes are created in the pool of the list and linked in one pass,
+         * then spliced at once. If the file is not valid for T, or if Ordered is
+         * true and the values are not in order, an error occurs and the list is
+         * left unchanged.
+         * @tparam Ordered If true the values must be in ascending order. Only
+         * then T needs operator<.
+         * @param[in] path The path of a file written by save.
+         * @return True if the values have been loaded, false otherwise.
+         */
+        template<bool Ordered>
+        bool load_from(const std::string &path);
+
+        /**
+         * @brief Submit to pool a task for each segment. The list is walked, and
+         * each segment is submitted as soon as its first node is reached, unless
+         * the links didn't change since the last call.
+         * @tparam Pool ThreadPool, or a pool with the same size and submit.
+         * @tparam Segment A callable with the first node of a segment and its
+         * length that returns R.
+         * @param[in] pool The pool that runs the segments.
+         * @param[in] segment The task of a segment.
+         * @return The results of the segments, in list order.
          */
-        SentinelNode<T> &head();
+        template<typename Pool, typename Segment>
+        auto submit_segments(Pool &pool, Segment segment);
 
         /**
-         * @brief Return the tail of the list.
-         * @return The tail of the list.
+         * @brief Create a node in the pool of the list, that is allocated by the
+         * first call, with the value constructed in place from args.
+         * @tparam Args The types of the arguments of the constructor of T.
+         * @param[in] args The arguments of the constructor of T.
+         * @return The new node, not linked.
          */
-        SentinelNode<T> &tail();
+        template<typename... Args>
+        Node<T> &create_node(Args &&... args);
+
+        /**
+         * @brief Release the memory of a node removed from the list, if the list
+         * owns it: a node of the pool goes back to the pool, a node created by
+         * create_from_array is deleted. Other nodes are left untouched.
+         * @param[in] node A node not linked.
+         */
+        void dispose(Node<T> &node);
+
+        /**
+         * @brief Create the pool of the list on resource, so that all the nodes
+         * the list creates are taken from it. The list must not have a pool yet.
+         * @param[in] resource The resource, that must outlive the list and the
+         * lists extracted from it.
+         */
+        void use_resource(MemoryResource *resource);
 
         int32_t _size{0}; /**<  Number of elements */
-        SentinelNode<T> _head{
-                sl::SentinelNode<T>::SENTINEL_TYPE::HEAD
-        }; /**<  Head of the list */
-        SentinelNode<T> _tail{
-                sl::SentinelNode<T>::SENTINEL_TYPE::TAIL
-        }; /**<  Tail of the list */
+        SentinelNode<T> _sentinel; /**<  Both the head and the tail of the list */
+        bool _allocated{false}; /**<  It's true if the list has been created with
+                               create_from_array. */
+        std::shared_ptr<NodePool<T>> _pool; /**<  The nodes created by emplace,
+                                               shared with the extracted lists. */
+        uint64_t _version{0}; /**<  Incremented by every change of the links. */
+        std::vector<Node<T> *> _jumps; /**<  The nodes in list order, built by
+                                          apply_prefetched. */
+        uint64_t _jumps_version{0}; /**<  The _version of _jumps. */
+        AbstractMutationLog<T> *_log{nullptr}; /**<  The log of the mutations, if
+                                                  any. */
 
     private:
         /**
-         * Auxiliary apply that applies lambda to a node.
-         * @param[in] node The node where to apply lambda.
-         * @param[in] lambda The function to apply to node.
+         * @brief Check if node goes before prev, for the order check of
+         * load_from<true>.
+         * @param[in] prev The previous node.
+         * @param[in] node The next node.
+         * @return True if the nodes are out of order.
+         */
+        static bool out_of_order(const Node<T> &prev, const Node<T> &node, std::true_type);
+
+        /**
+         * @brief The order of load_from<false> is not checked, so T doesn't need
+         * operator<.
+         * @return False.
+         */
+        static bool out_of_order(const Node<T> &, const Node<T> &, std::false_type);
+
+        /**
+         * @brief Copy the values, in list order, to blocks of at most
+         * BlockKernels<T>::block_size values and call kernel on each block.
+         * @tparam Kernel A callable with a T* and a size_t param.
+         * @param[in] kernel The function called on each block.
+         * @param[in] write_back If true the values of each block are copied back
+         * to the nodes after kernel.
          */
-        void apply_aux(Node<T> &node, void (*lambda)(Node<T> &node));
+        template<typename Kernel>
+        void for_each_block(Kernel &&kernel, bool write_back);
+
+        /**
+         * @brief Check if each node is followed in memory by the next one.
+         * @return True if the nodes form an array in list order, false otherwise.
+         */
+        bool contiguous() const;
+
+        std::vector<Node<T> *> _segments; /**<  The first nodes of the segments of
+                                             the last parallel call. */
+        uint64_t _segments_version{0}; /**<  The _version of _segments. */
     };
 
 } // namespace simple_list
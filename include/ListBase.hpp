@@ -0,0 +1,90 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include "List.hpp"
+
+namespace simple_list {
+
+/**
+ * @brief The static interface of the lists. Derived names the concrete list, so
+ * push and pop_front, that are not virtual, call the add and remove_front of
+ * Derived bound at compile time, and their small bodies can be inlined into
+ * generic code that takes a ListBase<Derived, T>& instead of a List<T>&. The
+ * names differ from add and remove_front on purpose: the same signatures would
+ * override the pure virtuals of List and be dispatched through the vtable
+ * again. A class derived from Derived that overrides add is not reached by
+ * push. The virtual interface of List stays available to the code that picks
+ * the list at run time.
+ * @tparam Derived The concrete list, that derives from ListBase<Derived, T>.
+ * @tparam T Type of the list.
+ */
+    template<typename Derived, typename T>
+    class ListBase : public List<T> {
+    public:
+        /**
+         * @brief Add a node to the list with the add of Derived, without virtual
+         * dispatch.
+         * @param[in] node The node to add.
+         */
+        void push(Node<T> &node);
+
+        /**
+         * @brief Remove the first node of the list with the remove_front of
+         * Derived, without virtual dispatch.
+         * @return The removed node.
+         */
+        Node<T> &pop_front();
+
+        /**
+         * @brief Return the concrete list.
+         * @return The current list as a Derived.
+         */
+        Derived &derived();
+
+        /**
+         * @brief Return the concrete list.
+         * @return The current list as a Derived.
+         */
+        const Derived &derived() const;
+
+    protected:
+        /**
+         * @brief Only the derived lists can be created.
+         */
+        ListBase() = default;
+    };
+
+} // namespace simple_list
+
+#include "impl/ListBase.i.hpp"
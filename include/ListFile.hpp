@@ -0,0 +1,112 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+namespace simple_list {
+
+/**
+ * @brief The binary format of the saved lists. A file is a header followed by
+ * the values in list order, as raw bytes:
+ *
+ * | bytes | field                                               |
+ * |-------|-----------------------------------------------------|
+ * | 4     | magic "SLST"                                        |
+ * | 2     | format version                                      |
+ * | 1     | kind of T: 'i' signed, 'u' unsigned, 'f' floating  |
+ * |       | point, 'b' other trivially copyable types           |
+ * | 1     | reserved, zero                                      |
+ * | 4     | 0x01020304 in the byte order of the writer          |
+ * | 4     | sizeof(T), unsigned                                 |
+ * | 8     | number of values                                    |
+ *
+ * A file written with the other byte order is read back by swapping the bytes
+ * of the header and, for arithmetic types, of each value.
+ * @tparam T The type of the values, trivially copyable.
+ */
+    template<typename T>
+    class ListFile {
+    public:
+        static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be saved");
+
+        static constexpr uint16_t version = 2; /**< The version of the format. */
+
+        /**
+         * @brief Write the header of a file of count values.
+         * @param[in] out The binary stream.
+         * @param[in] count The number of values.
+         * @return True if the header has been written, false otherwise.
+         */
+        static bool write_header(std::ostream &out, uint64_t count);
+
+        /**
+         * @brief Read and check the header of a file. If it doesn't match T an
+         * error occurs.
+         * @param[in] in The binary stream.
+         * @param[out] count The number of values.
+         * @param[out] swap True if the values are in the other byte order.
+         * @return True if the header is valid for T, false otherwise.
+         */
+        static bool read_header(std::istream &in, uint64_t &count, bool &swap);
+
+        /**
+         * @brief Reverse the byte order of value.
+         * @param[in,out] value The value.
+         */
+        static void swap_bytes(T &value);
+
+        /**
+         * @brief Return the kind of T stored in the header.
+         * @return 'i', 'u', 'f' or 'b'.
+         */
+        static constexpr char kind();
+
+    private:
+        /**
+         * @brief Reverse the byte order of an integer of the header.
+         * @tparam U An unsigned integer type.
+         * @param[in] value The integer.
+         * @return The integer with the bytes reversed.
+         */
+        template<typename U>
+        static U swapped(U value);
+    };
+
+} // namespace simple_list
+
+#include "impl/ListFile.i.hpp"
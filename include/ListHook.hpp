@@ -0,0 +1,176 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+#pragma once
+
+#include "CheckPolicy.hpp"
+#include "RingLinks.hpp"
+#include <cstddef>
+
+namespace simple_list {
+
+    template<typename T, typename Hook>
+    class IntrusiveList;
+
+/**
+ * @brief The tag of the hooks declared without one.
+ */
+    struct DefaultHookTag {
+    };
+
+/**
+ * @brief The links that a user object embeds to be stored in an intrusive list,
+ * as a base class or as a member. An object can be in several lists at once
+ * with a hook for each list, distinguished by Tag. The ring operations are
+ * those of RingLinks, private so that only the lists change the links.
+ * @tparam Tag A type that tells apart the hooks of the same object.
+ * @tparam Check The checking policy of the lists of the hook: Unchecked,
+ * Asserting or Throwing.
+ */
+    template<typename Tag = DefaultHookTag, typename Check = DefaultCheck>
+    class ListHook : private RingLinks<ListHook<Tag, Check>> {
+    public:
+        using check_type = Check; /**< The checking policy. */
+
+        /**
+         * @brief Create a hook not linked.
+         */
+        ListHook() = default;
+
+        /**
+         * @brief Create a hook not linked: a copy of an object is not in the
+         * lists of the original.
+         * @param[in] obj The other hook.
+         */
+        ListHook(const ListHook &obj);
+
+        /**
+         * @brief Keep the links of the current hook: the assigned object stays in
+         * its lists.
+         * @param[in] obj The other hook.
+         * @return The current hook.
+         */
+        ListHook &operator=(const ListHook &obj);
+
+        /**
+         * @brief Destroy the hook. The policy checks that it's not linked: with
+         * Throwing the program terminates, since a dtor can't throw.
+         */
+        ~ListHook();
+
+        /**
+         * @brief Check if the hook is in a list.
+         * @return True if the hook is linked, false otherwise.
+         */
+        bool linked() const;
+
+    private:
+        friend class RingLinks<ListHook<Tag, Check>>;
+
+        template<typename T, typename Hook>
+        friend class IntrusiveList;
+    };
+
+/**
+ * @brief Hook policy for the objects that derive from ListHook<Tag, Check>.
+ * @tparam T The type of the objects.
+ * @tparam Tag The tag of the hook.
+ * @tparam Check The checking policy of the hook.
+ */
+    template<typename T, typename Tag = DefaultHookTag, typename Check = DefaultCheck>
+    struct BaseHook {
+        using hook_type = ListHook<Tag, Check>; /**< The type of the hook. */
+
+        /**
+         * @brief Return the hook of value.
+         * @param[in] value An object.
+         * @return The hook of the object.
+         */
+        static hook_type &to_hook(T &value);
+
+        /**
+         * @brief Return the hook of value.
+         * @param[in] value An object.
+         * @return The hook of the object.
+         */
+        static const hook_type &to_hook(const T &value);
+
+        /**
+         * @brief Return the object that contains hook.
+         * @param[in] hook The hook of an object.
+         * @return The object.
+         */
+        static T &to_value(hook_type &hook);
+    };
+
+/**
+ * @brief Hook policy for the objects that have a ListHook as a member.
+ * @tparam T The type of the objects.
+ * @tparam Hook The type of the member, a ListHook.
+ * @tparam Member The pointer to the member.
+ */
+    template<typename T, typename Hook, Hook T::*Member>
+    struct MemberHook {
+        using hook_type = Hook; /**< The type of the hook. */
+
+        /**
+         * @brief Return the hook of value.
+         * @param[in] value An object.
+         * @return The hook of the object.
+         */
+        static hook_type &to_hook(T &value);
+
+        /**
+         * @brief Return the hook of value.
+         * @param[in] value An object.
+         * @return The hook of the object.
+         */
+        static const hook_type &to_hook(const T &value);
+
+        /**
+         * @brief Return the object that contains hook, going back by the offset
+         * of the member.
+         * @param[in] hook The hook of an object.
+         * @return The object.
+         */
+        static T &to_value(hook_type &hook);
+
+    private:
+        /**
+         * @brief Return the offset of the member in T.
+         * @return The offset in bytes.
+         */
+        static std::ptrdiff_t offset();
+    };
+
+} // namespace simple_list
+
+#include "impl/ListHook.i.hpp"
@@ -0,0 +1,158 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+#pragma once
+
+#include "Node.hpp"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace simple_list {
+
+/**
+ * @brief A bidirectional iterator over the values of a list. It wraps a pointer
+ * to the links of a node, so the end of the list is its sentinel and
+ * decrementing the end reaches the last node.
+ * @tparam T The type of the list.
+ * @tparam V T for a mutable iterator, const T for a constant one.
+ */
+    template<typename T, typename V>
+    class ListIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag; /**< The category. */
+        using value_type = typename std::remove_const<V>::type; /**< The type of the values. */
+        using difference_type = std::ptrdiff_t; /**< The distance between iterators. */
+        using pointer = V *; /**< A pointer to a value. */
+        using reference = V &; /**< A reference to a value. */
+
+        /**
+         * @brief The links the iterator points to, const for a constant iterator.
+         */
+        using Link = typename std::conditional<std::is_const<V>::value,
+                const NodeBase<T>, NodeBase<T>>::type;
+
+        /**
+         * @brief The nodes the iterator reaches, const for a constant iterator.
+         */
+        using NodeType = typename std::conditional<std::is_const<V>::value,
+                const Node<T>, Node<T>>::type;
+
+        /**
+         * @brief Create a singular iterator.
+         */
+        ListIterator() = default;
+
+        /**
+         * @brief Create an iterator to link.
+         * @param[in] link A node of a list or its sentinel.
+         */
+        explicit ListIterator(Link *link);
+
+        /**
+         * @brief Convert a mutable iterator to a constant one.
+         * @tparam U The type of the values of the other iterator.
+         * @param[in] obj The other iterator.
+         */
+        template<typename U, typename = typename std::enable_if<
+                std::is_same<const U, V>::value && !std::is_same<U, V>::value>::type>
+        ListIterator(const ListIterator<T, U> &obj);
+
+        /**
+         * @brief Return the value of the node.
+         * @return The value.
+         */
+        reference operator*() const;
+
+        /**
+         * @brief Return a pointer to the value of the node.
+         * @return The pointer to the value.
+         */
+        pointer operator->() const;
+
+        /**
+         * @brief Move to the next node.
+         * @return The current iterator.
+         */
+        ListIterator &operator++();
+
+        /**
+         * @brief Move to the next node.
+         * @return The iterator before the move.
+         */
+        ListIterator operator++(int);
+
+        /**
+         * @brief Move to the previous node.
+         * @return The current iterator.
+         */
+        ListIterator &operator--();
+
+        /**
+         * @brief Move to the previous node.
+         * @return The iterator before the move.
+         */
+        ListIterator operator--(int);
+
+        /**
+         * @brief Compare the nodes of two iterators.
+         * @param[in] b The other iterator.
+         * @return True if the iterators point to the same node, false otherwise.
+         */
+        bool operator==(const ListIterator &b) const;
+
+        /**
+         * @brief Compare the nodes of two iterators.
+         * @param[in] b The other iterator.
+         * @return True if the iterators point to different nodes, false otherwise.
+         */
+        bool operator!=(const ListIterator &b) const;
+
+        /**
+         * @brief Return the node the iterator points to, for the functions of the
+         * list that take nodes. The iterator must not be the end.
+         * @return The node.
+         */
+        NodeType &node() const;
+
+        /**
+         * @brief Return the links the iterator points to.
+         * @return The links.
+         */
+        Link *link() const;
+
+    private:
+        Link *_link{nullptr}; /**< The node or the sentinel. */
+    };
+
+} // namespace simple_list
+
+#include "impl/ListIterator.i.hpp"
@@ -0,0 +1,228 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include "Node.hpp"
+#include "ThreadPool.hpp"
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+namespace simple_list {
+
+/**
+ * @brief Sorting algorithms that work on null-terminated chains of nodes.
+ *
+ * Nodes are only relinked: no node is allocated, copied or destroyed and the
+ * values never move.
+ * @tparam T The type of the nodes.
+ */
+    template<typename T>
+    class ListSort {
+    public:
+        /**
+         * @brief Stable, non-recursive bottom-up merge sort of the chain that
+         * goes from first to last. Runs in O(n log n) time and O(1) extra space.
+         * Only the next links of the chain need to be valid on input.
+         * @tparam Compare A strict weak ordering on values of type T.
+         * @param[in,out] first The first node of the chain, updated to the new
+         * first node.
+         * @param[in,out] last The last node of the chain, updated to the new last
+         * node.
+         * @param[in] comp The comparison function.
+         */
+        template<typename Compare>
+        static void merge_sort(Node<T> *&first, Node<T> *&last, Compare comp);
+
+        /**
+         * @brief Stable LSD radix sort of the chain that goes from first to last.
+         * Every pass distributes the nodes in 256 bucket chains by relinking
+         * them and then concatenates the buckets, so the sort runs in linear
+         * time. Passes where all the keys share the same byte are skipped.
+         * Only the next links of the chain need to be valid on input.
+         * @param[in,out] first The first node of the chain, updated to the new
+         * first node.
+         * @param[in,out] last The last node of the chain, updated to the new last
+         * node.
+         */
+        static void radix_sort(Node<T> *&first, Node<T> *&last);
+
+        /**
+         * @brief Merge sorted chains pairwise, running the merges of every round
+         * on the pool. The order of the chains is kept, so the result is stable.
+         * @tparam Compare A strict weak ordering on values of type T.
+         * @param[in] pool The pool that runs the merges.
+         * @param[in,out] firsts The first nodes of the chains, on return it only
+         * holds the first node of the merged chain.
+         * @param[in,out] lasts The last nodes of the chains, on return it only
+         * holds the last node of the merged chain.
+         * @param[in] comp The comparison function.
+         */
+        template<typename Compare>
+        static void parallel_merge(ThreadPool &pool, std::vector<Node<T> *> &firsts,
+                                   std::vector<Node<T> *> &lasts, Compare comp);
+
+        /**
+         * @brief Cut a chain of count nodes in parts null-terminated chains of
+         * about the same length.
+         * @param[in] first The first node of the chain.
+         * @param[in] count The number of nodes of the chain.
+         * @param[in] parts The number of chains to make, at most count.
+         * @param[out] firsts The first nodes of the chains.
+         * @param[out] lasts The last nodes of the chains.
+         */
+        static void split(Node<T> *first, size_t count, size_t parts,
+                          std::vector<Node<T> *> &firsts, std::vector<Node<T> *> &lasts);
+
+        /**
+         * @brief Stable merge of two sorted null-terminated chains. Both next and
+         * previous links of the merged nodes are updated, the nodes left in one
+         * chain when the other ends are attached as they are.
+         * @tparam Compare A strict weak ordering on values of type T.
+         * @param[in] left The first chain, it wins on equal values.
+         * @param[in] right The second chain.
+         * @param[in] comp The comparison function.
+         * @return The first node of the merged chain.
+         */
+        template<typename Compare>
+        static Node<T> *merge(Node<T> *left, Node<T> *right, Compare comp);
+
+        /**
+         * @brief Rebuild the previous links of a chain whose next links are
+         * valid.
+         * @param[in] first The first node of the chain.
+         * @return The last node of the chain.
+         */
+        static Node<T> *relink_prev(Node<T> *first);
+
+        /**
+         * @brief Return the node after node, nullptr at the end of the chain.
+         * @param[in] node The current node.
+         * @return The next node or nullptr.
+         */
+        static Node<T> *next_of(Node<T> *node);
+
+    private:
+        static constexpr int kBins = 64; /**< Enough bins for 2^64 nodes. */
+        static constexpr int kBuckets = 256; /**< Buckets of a radix pass. */
+    };
+
+/**
+ * @brief Unsigned integer type with the given size in bytes.
+ * @tparam N The size in bytes.
+ */
+    template<size_t N>
+    struct RadixUnsigned;
+
+    template<>
+    struct RadixUnsigned<1> {
+        using type = uint8_t;
+    };
+
+    template<>
+    struct RadixUnsigned<2> {
+        using type = uint16_t;
+    };
+
+    template<>
+    struct RadixUnsigned<4> {
+        using type = uint32_t;
+    };
+
+    template<>
+    struct RadixUnsigned<8> {
+        using type = uint64_t;
+    };
+
+/**
+ * @brief Map a value to an unsigned key whose natural order is the order of
+ * the values.
+ * @tparam T An integral or floating point type.
+ */
+    template<typename T, typename Enable = void>
+    struct RadixKey;
+
+    template<typename T>
+    struct RadixKey<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+        using type = typename RadixUnsigned<sizeof(T)>::type;
+
+        /**
+         * @brief Flip the sign bit of signed values so negatives come first.
+         * @param[in] value The value.
+         * @return The key of the value.
+         */
+        static type key(T value);
+    };
+
+    template<typename T>
+    struct RadixKey<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+        using type = typename RadixUnsigned<sizeof(T)>::type;
+
+        /**
+         * @brief Flip all the bits of negative values and only the sign bit of
+         * positive ones, so the IEEE 754 bit patterns sort as unsigned integers.
+         * @param[in] value The value.
+         * @return The key of the value.
+         */
+        static type key(T value);
+    };
+
+/**
+ * @brief The sort used when no comparison function is given: LSD radix sort for
+ * integral and floating point values, merge sort with std::less otherwise.
+ * @tparam T The type of the nodes.
+ */
+    template<typename T, typename Enable = void>
+    struct DefaultSort {
+        /**
+         * @brief Sort the chain that goes from first to last in ascending order.
+         * @param[in,out] first The first node of the chain.
+         * @param[in,out] last The last node of the chain.
+         */
+        static void sort(Node<T> *&first, Node<T> *&last);
+    };
+
+    template<typename T>
+    struct DefaultSort<T, typename std::enable_if<std::is_integral<T>::value && sizeof(T) <= 8>::type> {
+        static void sort(Node<T> *&first, Node<T> *&last);
+    };
+
+    template<typename T>
+    struct DefaultSort<T, typename std::enable_if<std::is_floating_point<T>::value && sizeof(T) <= 8>::type> {
+        static void sort(Node<T> *&first, Node<T> *&last);
+    };
+
+} // namespace simple_list
+
+#include "impl/ListSort.i.hpp"
@@ -0,0 +1,134 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include "UnorderedList.hpp"
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+namespace simple_list {
+
+/**
+ * @brief A least recently used cache. The entries are the nodes of an
+ * UnorderedList kept in recency order, most recent first, so promoting an
+ * entry is an O(1) relink and the victim of an eviction is the last node.
+ * @tparam K The type of the keys.
+ * @tparam V The type of the values.
+ * @tparam Hash The hash function of the keys.
+ */
+    template<typename K, typename V, typename Hash = std::hash<K>>
+    class LruCache {
+    public:
+        /**
+         * @brief Create an empty cache.
+         * @param[in] capacity The maximum number of entries, at least one.
+         */
+        explicit LruCache(size_t capacity);
+
+        /**
+         * @brief Default dtor, the entries live in the pool of the list.
+         */
+        ~LruCache() = default;
+
+        LruCache(const LruCache &obj) = delete;
+
+        LruCache &operator=(const LruCache &obj) = delete;
+
+        /**
+         * @brief Look up key and, on a hit, make it the most recently used entry.
+         * @param[in] key The key to search.
+         * @param[out] value The value of the entry, untouched on a miss.
+         * @return True on a hit, false on a miss.
+         */
+        bool get(const K &key, V &value);
+
+        /**
+         * @brief Insert or update the entry of key and make it the most recently
+         * used. If the cache is full the least recently used entry is evicted
+         * and its node is reused.
+         * @param[in] key The key.
+         * @param[in] value The value.
+         */
+        void put(const K &key, const V &value);
+
+        /**
+         * @brief Return the number of entries.
+         * @return The number of entries.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Return the maximum number of entries.
+         * @return The capacity of the cache.
+         */
+        size_t capacity() const;
+
+        /**
+         * @brief Return the number of get calls that found the key.
+         * @return The number of hits.
+         */
+        uint64_t hits() const;
+
+        /**
+         * @brief Return the number of get calls that didn't find the key.
+         * @return The number of misses.
+         */
+        uint64_t misses() const;
+
+        /**
+         * @brief Return the number of entries evicted to make room.
+         * @return The number of evictions.
+         */
+        uint64_t evictions() const;
+
+    private:
+        /**
+         * @brief An entry of the cache.
+         */
+        struct Entry {
+            K key; /**< The key of the entry. */
+            V value; /**< The value of the entry. */
+        };
+
+        size_t _capacity; /**< Maximum number of entries. */
+        UnorderedList<Entry> _list; /**< The entries, most recent first. */
+        std::unordered_map<K, Node<Entry> *, Hash> _map; /**< Key to entry. */
+        uint64_t _hits{0}; /**< Number of hits. */
+        uint64_t _misses{0}; /**< Number of misses. */
+        uint64_t _evictions{0}; /**< Number of evictions. */
+    };
+
+} // namespace simple_list
+
+#include "impl/LruCache.i.hpp"
@@ -0,0 +1,119 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include "OffsetList.hpp"
+#include <cstdint>
+#include <string>
+
+namespace simple_list {
+
+/**
+ * @brief A list whose slots live in a file mapped in memory, so that it
+ * survives restarts without a load step: opening the file maps it and the list
+ * is ready. The links are self-relative offsets, so the file can be mapped at
+ * any address. When the slots are exhausted the file doubles and is mapped
+ * again.
+ *
+ * The changes reach the file through the page cache. sync() is the durability
+ * point: after it returns the list on disk is the current one. A crash between
+ * two syncs can leave the list on disk in an intermediate state. A new file is
+ * written aside and renamed, so a crash while creating it never leaves a file
+ * without its header.
+ * @tparam T The type of the values, trivially copyable.
+ */
+    template<typename T>
+    class MappedList : public OffsetList<T> {
+    public:
+        /**
+         * @brief Open the list saved in the file path, or create an empty one of
+         * capacity slots if the file doesn't exist or is empty. If the file
+         * can't be opened, mapped or doesn't hold a list of T an error occurs.
+         * @param[in] path The path of the file.
+         * @param[in] capacity The number of slots of a new file.
+         * @return The list, nullptr if the file can't be opened.
+         */
+        static MappedList<T> *open(const std::string &path, uint64_t capacity = 1024);
+
+        /**
+         * @brief Unmap and close the file, without waiting for the changes to
+         * reach the disk.
+         */
+        ~MappedList() override;
+
+        /**
+         * @brief Write the changes to the file and wait for the disk. If it fails
+         * an error occurs.
+         * @return True if the list on disk is the current one, false otherwise.
+         */
+        bool sync();
+
+    protected:
+        /**
+         * @brief Double the file and map it again.
+         * @return True if the file has grown, false otherwise.
+         */
+        bool grow() override;
+
+    private:
+        /**
+         * @brief Write an empty list of capacity slots in the file path plus
+         * ".tmp", wait for the disk and rename it to path. If it fails an error
+         * occurs.
+         * @param[in] path The path of the file.
+         * @param[in] capacity The number of slots.
+         * @return True if the file has been created, false otherwise.
+         */
+        static bool create(const std::string &path, uint64_t capacity);
+
+        /**
+         * @brief Create a list bound to an open file.
+         * @param[in] fd The file descriptor.
+         */
+        explicit MappedList(int fd);
+
+        /**
+         * @brief Map size bytes of the file and attach the list to them.
+         * @param[in] size The size of the file.
+         * @return True if the file has been mapped, false otherwise.
+         */
+        bool map(size_t size);
+
+        int _fd; /**<  The file descriptor. */
+        void *_mapping{nullptr}; /**<  The mapping of the file. */
+        size_t _bytes{0}; /**<  The size of the mapping. */
+    };
+
+} // namespace simple_list
+
+#include "impl/MappedList.i.hpp"
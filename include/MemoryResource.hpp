@@ -0,0 +1,230 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace simple_list {
+
+/**
+ * @brief Interface of a source of raw memory, shaped like std::pmr::memory_resource
+ * so that the lists can take their nodes from arenas, pools or buffers without
+ * changing their type. The public functions forward to the private virtual
+ * ones.
+ */
+    class MemoryResource {
+    public:
+        /**
+         * @brief Default dtor.
+         */
+        virtual ~MemoryResource() = default;
+
+        /**
+         * @brief Allocate bytes bytes aligned to alignment. If the memory can't be
+         * allocated std::bad_alloc is thrown, like by new.
+         * @param[in] bytes The number of bytes.
+         * @param[in] alignment A power of two.
+         * @return The memory.
+         */
+        void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+        /**
+         * @brief Release memory returned by allocate with the same bytes and
+         * alignment.
+         * @param[in] pointer The memory.
+         * @param[in] bytes The number of bytes.
+         * @param[in] alignment The alignment.
+         */
+        void deallocate(void *pointer, size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+        /**
+         * @brief Check if memory allocated by this resource can be released by
+         * other and vice versa.
+         * @param[in] other The other resource.
+         * @return True if the resources are interchangeable.
+         */
+        bool is_equal(const MemoryResource &other) const;
+
+    private:
+        /**
+         * @brief Allocate the memory of allocate.
+         * @param[in] bytes The number of bytes.
+         * @param[in] alignment A power of two.
+         * @return The memory.
+         */
+        virtual void *do_allocate(size_t bytes, size_t alignment) = 0;
+
+        /**
+         * @brief Release the memory of deallocate.
+         * @param[in] pointer The memory.
+         * @param[in] bytes The number of bytes.
+         * @param[in] alignment The alignment.
+         */
+        virtual void do_deallocate(void *pointer, size_t bytes, size_t alignment) = 0;
+
+        /**
+         * @brief Compare with other for is_equal. By default a resource is equal
+         * only to itself.
+         * @param[in] other The other resource.
+         * @return True if the resources are interchangeable.
+         */
+        virtual bool do_is_equal(const MemoryResource &other) const;
+    };
+
+/**
+ * @brief Return the resource that allocates with the global operator new, the
+ * default of the lists.
+ * @return The resource, that lives as long as the program.
+ */
+    MemoryResource *new_delete_resource();
+
+/**
+ * @brief An arena: the memory is handed out by bumping a pointer in blocks
+ * taken from an upstream resource, and released all at once by release or by
+ * the dtor. deallocate does nothing, so a list on an arena never returns
+ * memory until the arena goes away. The first block can be a buffer of the
+ * caller, like one on the stack.
+ */
+    class MonotonicBuffer : public MemoryResource {
+    public:
+        /**
+         * @brief Create an arena whose first block, allocated on first use, has
+         * size bytes.
+         * @param[in] size The size of the first block, the next ones double.
+         * @param[in] upstream The resource of the blocks.
+         */
+        explicit MonotonicBuffer(size_t size = 4096, MemoryResource *upstream = new_delete_resource());
+
+        /**
+         * @brief Create an arena that starts from buffer, and takes the next
+         * blocks from upstream when it's exhausted.
+         * @param[in] buffer The first block, owned by the caller.
+         * @param[in] size The size of buffer.
+         * @param[in] upstream The resource of the next blocks.
+         */
+        MonotonicBuffer(void *buffer, size_t size, MemoryResource *upstream = new_delete_resource());
+
+        /**
+         * @brief The arena owns its blocks, so it can't be copied.
+         * @param[in] obj The other arena.
+         */
+        MonotonicBuffer(const MonotonicBuffer &obj) = delete;
+
+        /**
+         * @brief The arena owns its blocks, so it can't be assigned.
+         * @param[in] obj The other arena.
+         * @return The current arena.
+         */
+        MonotonicBuffer &operator=(const MonotonicBuffer &obj) = delete;
+
+        /**
+         * @brief Release all the blocks.
+         */
+        ~MonotonicBuffer() override;
+
+        /**
+         * @brief Give all the blocks back to upstream, and start again from the
+         * buffer of the caller, if any. The memory handed out must not be used
+         * anymore.
+         */
+        void release();
+
+        /**
+         * @brief Return the number of bytes taken from upstream.
+         * @return The size of the blocks.
+         */
+        size_t upstream_bytes() const;
+
+    private:
+        /**
+         * @brief A block taken from upstream.
+         */
+        struct Block {
+            void *memory; /**< The memory. */
+            size_t size; /**< The size in bytes. */
+        };
+
+        void *do_allocate(size_t bytes, size_t alignment) override;
+
+        void do_deallocate(void *pointer, size_t bytes, size_t alignment) override;
+
+        MemoryResource *_upstream; /**<  The resource of the blocks. */
+        void *_buffer; /**<  The buffer of the caller, or nullptr. */
+        size_t _buffer_size; /**<  The size of _buffer. */
+        std::vector<Block> _blocks; /**<  The blocks taken from upstream. */
+        char *_current; /**<  The next free byte. */
+        size_t _left; /**<  The free bytes after _current. */
+        size_t _next_size; /**<  The size of the next block. */
+    };
+
+/**
+ * @brief Adapt a standard allocator, like the ones of a container, to a
+ * MemoryResource, so that a list can be fed by an allocator without having it
+ * in its type. The allocator is rebound to units of std::max_align_t, so
+ * alignments larger than that are not supported and throw std::bad_alloc.
+ * @tparam Allocator A standard allocator of any value type.
+ */
+    template<typename Allocator>
+    class AllocatorResource : public MemoryResource {
+    public:
+        /**
+         * @brief Create a resource that allocates with a copy of allocator.
+         * @param[in] allocator The allocator.
+         */
+        explicit AllocatorResource(const Allocator &allocator = Allocator());
+
+    private:
+        using Unit = std::max_align_t; /**< The unit of the rebound allocator. */
+        using Traits = typename std::allocator_traits<Allocator>::template rebind_traits<Unit>;
+
+        /**
+         * @brief Return the number of units that hold bytes bytes.
+         * @param[in] bytes The number of bytes.
+         * @return The number of units.
+         */
+        static size_t units(size_t bytes);
+
+        void *do_allocate(size_t bytes, size_t alignment) override;
+
+        void do_deallocate(void *pointer, size_t bytes, size_t alignment) override;
+
+        bool do_is_equal(const MemoryResource &other) const override;
+
+        typename Traits::allocator_type _allocator; /**<  The rebound allocator. */
+    };
+
+} // namespace simple_list
+
+#include "impl/MemoryResource.i.hpp"
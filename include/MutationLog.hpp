@@ -0,0 +1,172 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include "AbstractMutationLog.hpp"
+#include "ListFile.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace simple_list {
+
+/**
+ * @brief A write-ahead log of the mutations of a list, in a file. The records
+ * are a byte for the mutation followed by the value or the index, and are
+ * written in groups: a group is appended with a single write and a single
+ * fdatasync, so the cost of the sync is shared by all its records. A group
+ * starts with its length and a checksum of its records, so a group torn by a
+ * crash is detected and dropped as a whole: a record is durable when the group
+ * that holds it has been committed.
+ *
+ * The file starts with a 16 bytes header like the one of ListFile: magic
+ * "SLWL", version, kind of T, a reserved byte, the byte order marker and
+ * sizeof(T) as an unsigned 32 bits integer.
+ * @tparam T The type of the values, trivially copyable.
+ */
+    template<typename T>
+    class MutationLog : public AbstractMutationLog<T> {
+    public:
+        static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be logged");
+
+        static constexpr uint16_t version = 2; /**< The version of the format. */
+
+        /**
+         * @brief Open the log in the file path, or create it. A group torn by a
+         * crash at the end of the file is cut away. If the file can't be opened
+         * or isn't a log of T an error occurs.
+         * @param[in] path The path of the file.
+         * @param[in] group The number of records that commits a group.
+         * @return The log, nullptr if the file can't be opened.
+         */
+        static MutationLog<T> *open(const std::string &path, size_t group = 256);
+
+        /**
+         * @brief Read the committed groups of the log in the file path and pass
+         * each record to visitor, in order. A group torn at the end of the file
+         * is ignored. If the file isn't a log of T an error occurs.
+         * @tparam Visitor A callable with a LogOp, a const T& and an int32_t param
+         * that returns false to stop.
+         * @param[in] path The path of the file.
+         * @param[in] visitor The function called on each record.
+         * @return True if all the records have been visited, false otherwise.
+         */
+        template<typename Visitor>
+        static bool read(const std::string &path, Visitor &&visitor);
+
+        /**
+         * @brief The log owns its file, so it can't be copied.
+         * @param[in] obj The other log.
+         */
+        MutationLog(const MutationLog &obj) = delete;
+
+        /**
+         * @brief The log owns its file, so it can't be assigned.
+         * @param[in] obj The other log.
+         * @return The current log.
+         */
+        MutationLog &operator=(const MutationLog &obj) = delete;
+
+        /**
+         * @brief Commit the pending records and close the file.
+         */
+        ~MutationLog() override;
+
+        void record_value(LogOp op, const T &value) override;
+
+        void record_index(LogOp op, int32_t index) override;
+
+        /**
+         * @brief Write the pending records as a group and wait for the disk. If it
+         * fails an error occurs and the records are kept.
+         * @return True if all the records are durable, false otherwise.
+         */
+        bool commit();
+
+        /**
+         * @brief Return the number of records not committed yet.
+         * @return The number of pending records.
+         */
+        size_t pending() const;
+
+    private:
+        /**
+         * @brief Create a log bound to an open file.
+         * @param[in] fd The file descriptor, at the end of the file.
+         * @param[in] end The size of the file.
+         * @param[in] group The number of records that commits a group.
+         */
+        MutationLog(int fd, size_t end, size_t group);
+
+        /**
+         * @brief Decode the committed groups of a log and pass each record to
+         * visitor.
+         * @tparam Visitor As in read.
+         * @param[in] data The content of the file.
+         * @param[in] size The size of the file.
+         * @param[in] visitor The function called on each record.
+         * @param[out] end The end of the last committed group.
+         * @return True if all the records have been visited, false otherwise.
+         */
+        template<typename Visitor>
+        static bool decode(const char *data, size_t size, Visitor &&visitor, size_t &end);
+
+        /**
+         * @brief Return the FNV-1a hash of size bytes.
+         * @param[in] data The bytes.
+         * @param[in] size The number of bytes.
+         * @return The hash.
+         */
+        static uint32_t checksum(const char *data, size_t size);
+
+        /**
+         * @brief Count a record, and commit the group if it's full.
+         */
+        void recorded();
+
+        static constexpr size_t header_size = 16; /**< The size of the file header. */
+        static constexpr size_t group_header_size = 8; /**< The length and the checksum. */
+
+        int _fd; /**<  The file descriptor. */
+        size_t _end; /**<  The end of the last committed group. */
+        size_t _group; /**<  The records of a group. */
+        size_t _pending{0}; /**<  The records in _buffer. */
+        std::vector<char> _buffer; /**<  The group being filled, after room for
+                                        its length and checksum. */
+    };
+
+} // namespace simple_list
+
+#include "impl/MutationLog.i.hpp"
@@ -32,30 +32,54 @@
 
 #pragma once
 
+#include "NodeBase.hpp"
 #include "SentinelNode.hpp"
-#include <iostream>
+#include <ostream>
 
 namespace simple_list {
-    template<typename T>
-    class SentinelNode;
 
 /**
- * @brief A node with pointer to the next and previous node.
+ * @brief Tag that selects the constructor of Node that builds the value in
+ * place.
+ */
+    struct InPlace {
+    };
+
+/**
+ * @brief A node with pointer to the next and previous node. The checking policy
+ * has a default declared in NodeBase.hpp.
  * @tparam T The type of the node.
+ * @tparam Check The checking policy of the accessors: Unchecked, Asserting or
+ * Throwing.
  */
-    template<typename T>
-    class Node {
+    template<typename T, typename Check>
+    class Node : public NodeBase<T, Check> {
     public:
         /**
-         * @brief Create a node with value set to zero.
+         * @brief Create a node with value initialized value, zero for arithmetic
+         * types.
          */
         explicit Node();
 
         /**
-         * @brief Create a node with value.
+         * @brief Create a node with a copy of value.
+         * @param[in] value The value of the node.
+         */
+        explicit Node(const T &value);
+
+        /**
+         * @brief Create a node moving value into it.
          * @param[in] value The value of the node.
          */
-        explicit Node(T value);
+        explicit Node(T &&value);
+
+        /**
+         * @brief Create a node whose value is constructed in place from args.
+         * @tparam Args The types of the arguments of the constructor of T.
+         * @param[in] args The arguments of the constructor of T.
+         */
+        template<typename... Args>
+        explicit Node(InPlace, Args &&... args);
 
         /**
          * @brief Default copy constructor
@@ -66,33 +90,34 @@ namespace simple_list {
         /**
          * @brief Writes the node value to the stream.
          * @tparam R The type of the node.
+         * @tparam C The checking policy of the node.
          * @param[in] stream The stream.
          * @param[in] node The node to output.
          * @return The modified stream.
          */
-        template<typename R>
-        friend std::ostream &operator<<(std::ostream &stream, const Node<R> &node);
+        template<typename R, typename C>
+        friend std::ostream &operator<<(std::ostream &stream, const Node<R, C> &node);
 
         /**
          * @brief Compare the address of the Node b with the current.
          * @param[in] b The other node.
          * @return True if the nodes have the same address, false otherwise.
          */
-        bool operator==(const Node<T> &b) const;
+        bool operator==(const Node<T, Check> &b) const;
 
         /**
          * @brief Compare the address of the SentinelNode b with the current.
          * @param[in] b The other node.
          * @return True if the nodes have the same address, false otherwise.
          */
-        bool operator==(const SentinelNode<T> &b) const;
+        bool operator==(const SentinelNode<T, Check> &b) const;
 
         /**
          * @brief Compare the address of the Node b with the current.
          * @param[in] b The other node.
          * @return True if the nodes have different address, false otherwise.
          */
-        bool operator!=(const Node<T> &b) const;
+        bool operator!=(const Node<T, Check> &b) const;
 
         /**
          * @brief Compare the value of the current node and b.
@@ -100,7 +125,7 @@ namespace simple_list {
          * @return True if the value of the current node is less than the value of
          * node b.
          */
-        bool operator<(const Node<T> &b) const;
+        bool operator<(const Node<T, Check> &b) const;
 
         /**
          * @brief Compare the value of the current node and b.
@@ -108,7 +133,7 @@ namespace simple_list {
          * @return True if the value of the current node is less or equal than the
          * value of node b.
          */
-        bool operator<=(const Node<T> &b) const;
+        bool operator<=(const Node<T, Check> &b) const;
 
         /**
          * @brief Compare the value of the current node and b.
@@ -116,7 +141,7 @@ namespace simple_list {
          * @return True if the value of the current node is greater than the value
          * of node b.
          */
-        bool operator>(const Node<T> &b) const;
+        bool operator>(const Node<T, Check> &b) const;
 
         /**
          * @brief Compare the value of the current node and b.
@@ -124,104 +149,41 @@ namespace simple_list {
          * @return True if the value of the current node is greater or equal than
          * the value of node b.
          */
-        bool operator>=(const Node<T> &b) const;
+        bool operator>=(const Node<T, Check> &b) const;
 
         /**
          * @brief Copy the content of obj to the current Node.
          * @param obj The other node.
          * @return The current node with the values of obj.
          */
-        Node<T> &operator=(const Node<T> &obj);
+        Node<T, Check> &operator=(const Node<T, Check> &obj);
 
         /**
          * @brief Return the value of the node.
          * @return The value of the node.
          */
-        T value() const;
+        const T &value() const;
 
         /**
-         * Set the value of the node to val.
-         * @param[in] val The new value.
-         */
-        void value(T val);
-
-        /**
-         * @brief Unset the pointers to the next and previous node.
-         */
-        void clear();
-
-        /**
-         * @brief Unset the pointer to the previous node.
-         */
-        void clear_prev();
-
-        /**
-         * @brief Unset the pointer to the next node.
-         */
-        void clear_next();
-
-        /**
-         * @brief Check if the node has a next node.
-         * @return True if the node has a valid next node, false otherwise.
-         */
-        bool has_next() const;
-
-        /**
-         * @brief Check if the node has a previous node.
-         * @return True if the node has a valid previous node, false otherwise.
-         */
-        bool has_prev() const;
-
-        /**
-         * @brief Return the next node. If the next node is invalid an error occurs.
-         * @return The next node.
-         */
-        Node<T> &next();
-
-        /**
-         * @brief Set the next Node to node.
-         * @param[in] node The node to set.
-         */
-        void next(Node<T> &node);
-
-        /**
-         * @brief Add node between the current and the next node.
-         * @param[in] node The node to insert.
-         */
-        void append_next(Node<T> &node);
-
-        /**
-         * @brief Return the previous node. If the previous node is invalid an error
-         * occurs.
-         * @return The previous node.
+         * @brief Return the value of the node, that can be modified in place.
+         * @return The value of the node.
          */
-        Node<T> &prev();
+        T &value();
 
         /**
-         * @brief Set the previous Node to node.
-         * @param[in] node The node to set.
+         * Set the value of the node to a copy of val.
+         * @param[in] val The new value.
          */
-        void prev(Node<T> &node);
+        void value(const T &val);
 
         /**
-         * @brief Add node between the current and the previous node.
-         * @param[in] node The node to insert.
+         * Set the value of the node moving val into it.
+         * @param[in] val The new value.
          */
-        void append_prev(Node<T> &node);
+        void value(T &&val);
 
     protected:
-        T _value{0}; /**<  The value of the node. */
-        Node<T> *_next{nullptr}; /**<  The next node. */
-        Node<T> *_prev{nullptr}; /**<  The previous node. */
-        bool _has_next{false}; /**<  True if the next node is valid. */
-        bool _has_prev{false}; /**<  True if the previous node is valid. */
-
-    private:
-        /**
-         * @brief Check if a node is assigned to himself. If so a warning occurs.
-         * @param[in] node The other node.
-         */
-        void check_self_assignment(const Node<T> &node);
+        T _value{}; /**<  The value of the node. */
     };
 
 } // namespace simple_list
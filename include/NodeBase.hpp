@@ -0,0 +1,124 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include "CheckPolicy.hpp"
+#include "RingLinks.hpp"
+
+namespace simple_list {
+    template<typename T, typename Check = DefaultCheck>
+    class Node;
+
+/**
+ * @brief The links of a node to the next and previous node, without payload.
+ * A link is valid if it isn't null. In a list the links are never null: the
+ * nodes form a ring closed by the sentinel of the list. The ring operations are
+ * those of RingLinks, this class adds the accessors that return nodes.
+ * @tparam T The type of the linked nodes.
+ * @tparam Check The checking policy of the accessors: Unchecked, Asserting or
+ * Throwing.
+ */
+    template<typename T, typename Check = DefaultCheck>
+    class NodeBase : public RingLinks<NodeBase<T, Check>> {
+    public:
+        /**
+         * @brief Create a node without links.
+         */
+        NodeBase() = default;
+
+        /**
+         * @brief Default copy constructor
+         * @param[in] obj The other object.
+         */
+        NodeBase(const NodeBase &obj) = default;
+
+        /**
+         * @brief Copy the links of obj.
+         * @param[in] obj The other node.
+         * @return The current node.
+         */
+        NodeBase &operator=(const NodeBase &obj) = default;
+
+        /**
+         * @brief Return the next node. The policy checks that it is valid.
+         * @return The next node.
+         */
+        Node<T, Check> &next();
+
+        /**
+         * @brief Set the next Node to node.
+         * @param[in] node The node to set.
+         */
+        void next(NodeBase<T, Check> &node);
+
+        /**
+         * @brief Add node between the current and the next node.
+         * @param[in] node The node to insert.
+         */
+        void append_next(Node<T, Check> &node);
+
+        /**
+         * @brief Return the previous node. The policy checks that it is valid.
+         * @return The previous node.
+         */
+        Node<T, Check> &prev();
+
+        /**
+         * @brief Set the previous Node to node.
+         * @param[in] node The node to set.
+         */
+        void prev(NodeBase<T, Check> &node);
+
+        /**
+         * @brief Add node between the current and the previous node.
+         * @param[in] node The node to insert.
+         */
+        void append_prev(Node<T, Check> &node);
+
+    protected:
+        /**
+         * @brief Default dtor, nodes are never deleted through a NodeBase.
+         */
+        ~NodeBase() = default;
+
+    private:
+        /**
+         * @brief Check with the policy that a node is not assigned to himself.
+         * @param[in] node The other node.
+         */
+        void check_self_assignment(const NodeBase<T, Check> &node);
+    };
+
+} // namespace simple_list
+
+#include "impl/NodeBase.i.hpp"
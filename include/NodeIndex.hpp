@@ -0,0 +1,166 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include "Node.hpp"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace simple_list {
+
+/**
+ * @brief Interface of an index from the values of the nodes to the nodes. It
+ * lets a list keep an optional index without requiring a hash function for T
+ * until the index is enabled.
+ * @tparam T The type of the nodes.
+ */
+    template<typename T>
+    class AbstractNodeIndex {
+    public:
+        /**
+         * @brief Default dtor.
+         */
+        virtual ~AbstractNodeIndex() = default;
+
+        /**
+         * @brief Insert node, even if another node has the same value.
+         * @param[in] node The node to insert.
+         */
+        virtual void insert(Node<T> &node) = 0;
+
+        /**
+         * @brief Find a node with the given value.
+         * @param[in] value The value to search.
+         * @return A node with the value, nullptr if there isn't one.
+         */
+        virtual Node<T> *find(const T &value) const = 0;
+
+        /**
+         * @brief Remove node from the index. The other nodes with the same value
+         * are kept.
+         * @param[in] node The node to remove.
+         * @return True if the node was in the index.
+         */
+        virtual bool erase(const Node<T> &node) = 0;
+
+        /**
+         * @brief Return the memory used by the index.
+         * @return The size of the index in bytes.
+         */
+        virtual size_t memory() const = 0;
+    };
+
+/**
+ * @brief An open addressing hash table, with linear probing, from the values
+ * of the nodes to the nodes themselves. Many nodes can have the same value.
+ *
+ * The table stores a pointer to the node and the hash of its value, the value
+ * is read from the node only to confirm a match. A node must not change value
+ * while it's in the table.
+ * @tparam T The type of the nodes.
+ * @tparam Hash The hash function of the values.
+ */
+    template<typename T, typename Hash = std::hash<T>>
+    class NodeIndex : public AbstractNodeIndex<T> {
+    public:
+        /**
+         * @brief Create a table able to store expected nodes without growing.
+         * @param[in] expected The expected number of nodes.
+         */
+        explicit NodeIndex(size_t expected = 0);
+
+        void insert(Node<T> &node) override;
+
+        /**
+         * @brief Insert node only if no other node has the same value.
+         * @param[in] node The node to insert.
+         * @return The node already stored with the same value, nullptr if node
+         * has been inserted.
+         */
+        Node<T> *insert_unique(Node<T> &node);
+
+        Node<T> *find(const T &value) const override;
+
+        bool erase(const Node<T> &node) override;
+
+        /**
+         * @brief Remove all the nodes from the table.
+         */
+        void clear();
+
+        /**
+         * @brief Return the number of nodes in the table.
+         * @return The number of nodes.
+         */
+        size_t size() const;
+
+        size_t memory() const override;
+
+    private:
+        /**
+         * @brief A slot of the table, empty if node is nullptr.
+         */
+        struct Slot {
+            uint64_t hash; /**< The mixed hash of the value of node. */
+            Node<T> *node; /**< The stored node. */
+        };
+
+        /**
+         * @brief Hash a value and mix the bits, so that the low bits can be used
+         * as the position even when Hash is the identity.
+         * @param[in] value The value.
+         * @return The mixed hash.
+         */
+        uint64_t hash(const T &value) const;
+
+        /**
+         * @brief Double the capacity if inserting one more node would exceed the
+         * maximum load factor.
+         */
+        void reserve_one();
+
+        /**
+         * @brief Put a node in the first free slot of its probe sequence.
+         * @param[in] slot The slot to put.
+         */
+        void place(const Slot &slot);
+
+        std::vector<Slot> _slots; /**< The slots, a power of two. */
+        size_t _size{0}; /**< Number of stored nodes. */
+        Hash _hasher; /**< The hash function. */
+    };
+
+} // namespace simple_list
+
+#include "impl/NodeIndex.i.hpp"
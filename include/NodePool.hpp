@@ -0,0 +1,182 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+#pragma once
+
+#include "MemoryResource.hpp"
+#include "Node.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace simple_list {
+
+/**
+ * @brief Allocator of nodes in chunks of contiguous slots. The slots of the
+ * destroyed nodes are kept in a free list and reused by the next nodes. The
+ * nodes still alive are destroyed with the pool. The chunks are taken from a
+ * MemoryResource, that must outlive the pool.
+ * @tparam T The type of the values of the nodes.
+ */
+    template<typename T>
+    class NodePool {
+    public:
+        /**
+         * @brief Create an empty pool. No memory is allocated until the first
+         * node is created.
+         * @param[in] chunk The number of slots of the first chunk, the next chunks
+         * double the capacity of the pool.
+         * @param[in] resource The resource of the chunks.
+         */
+        explicit NodePool(size_t chunk = 64, MemoryResource *resource = new_delete_resource());
+
+        /**
+         * @brief Destroy the nodes still alive and release the chunks.
+         */
+        ~NodePool();
+
+        /**
+         * @brief A pool owns its chunks, so it can't be copied.
+         * @param[in] obj The other pool.
+         */
+        NodePool(const NodePool &obj) = delete;
+
+        /**
+         * @brief A pool owns its chunks, so it can't be assigned.
+         * @param[in] obj The other pool.
+         * @return The current pool.
+         */
+        NodePool &operator=(const NodePool &obj) = delete;
+
+        /**
+         * @brief Create a node without links whose value is constructed in place
+         * from args.
+         * @tparam Args The types of the arguments of the constructor of T.
+         * @param[in] args The arguments of the constructor of T.
+         * @return The new node.
+         */
+        template<typename... Args>
+        Node<T> *create(Args &&... args);
+
+        /**
+         * @brief Make the next count nodes come one after another from the same
+         * chunk, as long as the free list is empty. If the last chunk has less
+         * than count slots left, a new chunk is allocated and the rest of the
+         * last one is left unused.
+         * @param[in] count The number of nodes.
+         */
+        void reserve(size_t count);
+
+        /**
+         * @brief Destroy a node created by the pool and reuse its slot.
+         * @param[in] node A node created by the pool, not linked.
+         */
+        void destroy(Node<T> *node);
+
+        /**
+         * @brief Check if node lives in one of the chunks of the pool.
+         * @param[in] node Any node.
+         * @return True if node has been created by the pool, false otherwise.
+         */
+        bool owns(const Node<T> *node) const;
+
+        /**
+         * @brief Return the number of nodes alive.
+         * @return The number of nodes created and not destroyed.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Return the number of slots of all the chunks.
+         * @return The capacity of the pool.
+         */
+        size_t capacity() const;
+
+        /**
+         * @brief Return the resource of the chunks.
+         * @return The resource.
+         */
+        MemoryResource *resource() const;
+
+    private:
+        /**
+         * @brief Raw storage for a node. A free slot stores the pointer to the
+         * next free slot instead.
+         */
+        using Slot = typename std::aligned_storage<sizeof(Node<T>), alignof(Node<T>)>::type;
+
+        /**
+         * @brief A block of contiguous slots.
+         */
+        struct Chunk {
+            Slot *slots; /**< The slots. */
+            bool *alive; /**< True for the slots with a node. */
+            size_t count; /**< The number of slots. */
+        };
+
+        /**
+         * @brief Return a slot for a new node, from the free list or from the
+         * last chunk. A new chunk is allocated when both are exhausted.
+         * @return A free slot.
+         */
+        Slot *acquire();
+
+        /**
+         * @brief Allocate a chunk of count slots, where the next nodes are taken.
+         * @param[in] count The number of slots.
+         */
+        void grow(size_t count);
+
+        /**
+         * @brief Push slot in the free list.
+         * @param[in] slot A slot without a node.
+         */
+        void release(Slot *slot);
+
+        /**
+         * @brief Find the chunk that contains slot.
+         * @param[in] slot Any address.
+         * @return The chunk, or nullptr if no chunk contains slot.
+         */
+        const Chunk *find(const Slot *slot) const;
+
+        MemoryResource *_resource; /**< The resource of the chunks. */
+        std::vector<Chunk> _chunks; /**< The chunks, from the oldest. */
+        Slot *_free{nullptr}; /**< The head of the free list. */
+        size_t _chunk; /**< The number of slots of the first chunk. */
+        size_t _used{0}; /**< The slots of the last chunk handed out at least once. */
+        size_t _capacity{0}; /**< The number of slots of all the chunks. */
+        size_t _size{0}; /**< The number of nodes alive. */
+    };
+
+} // namespace simple_list
+
+#include "impl/NodePool.i.hpp"
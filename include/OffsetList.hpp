@@ -0,0 +1,332 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include "ListFile.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace simple_list {
+
+/**
+ * @brief A list stored in a region of memory that can be mapped at a different
+ * address by each run or process, like a file or a shared memory segment. The
+ * region is a header, that holds the sentinel, followed by an array of slots.
+ * The links are self-relative offsets, the distance in bytes from the links
+ * that hold them, so they stay valid wherever the region is mapped. A zeroed
+ * sentinel is an empty ring. The values are copied in and out of the slots.
+ *
+ * The list doesn't own the region: the derived classes map it, and can make it
+ * larger when it's full by overriding grow().
+ * @tparam T The type of the values, trivially copyable.
+ */
+    template<typename T>
+    class OffsetList {
+    public:
+        static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be mapped");
+
+        /**
+         * @brief The links of a slot or of the sentinel.
+         */
+        struct Links {
+            int64_t next; /**< The offset of the next links from these. */
+            int64_t prev; /**< The offset of the previous links from these. */
+        };
+
+        /**
+         * @brief The storage of a value. A free slot stores in links.next the
+         * index plus one of the next free slot.
+         */
+        struct Slot {
+            Links links; /**< The links, first so that a Links* is a Slot*. */
+            T value; /**< The value. */
+        };
+
+        /**
+         * @brief The beginning of the region.
+         */
+        struct Header {
+            char magic[4]; /**< "SLMP". */
+            uint16_t version; /**< The version of the layout. */
+            char kind; /**< The kind of T, as in ListFile. */
+            uint8_t reserved; /**< Zero. */
+            uint32_t value_size; /**< sizeof(T). */
+            uint64_t capacity; /**< The number of slots. */
+            uint64_t size; /**< The number of values. */
+            uint64_t used; /**< The slots used at least once. */
+            uint64_t free; /**< The index plus one of the first free slot, zero if none. */
+            Links sentinel; /**< Both the head and the tail of the list. */
+        };
+
+        static constexpr uint16_t version = 2; /**< The version of the layout. */
+
+        /**
+         * @brief Return the size of a region of capacity slots.
+         * @param[in] capacity The number of slots.
+         * @return The size in bytes.
+         */
+        static size_t bytes(uint64_t capacity);
+
+        /**
+         * @brief Write the header of an empty list in a zeroed region.
+         * @param[in] region The region, of at least bytes(capacity) bytes.
+         * @param[in] capacity The number of slots.
+         */
+        static void format(void *region, uint64_t capacity);
+
+        /**
+         * @brief Check if the region holds a list of T that fits in size bytes. If
+         * it doesn't an error occurs.
+         * @param[in] region The region.
+         * @param[in] size The size of the region in bytes.
+         * @return True if the region is valid, false otherwise.
+         */
+        static bool valid(const void *region, size_t size);
+
+        /**
+         * @brief The list is bound to its region, so it can't be copied.
+         * @param[in] obj The other list.
+         */
+        OffsetList(const OffsetList &obj) = delete;
+
+        /**
+         * @brief The list is bound to its region, so it can't be assigned.
+         * @param[in] obj The other list.
+         * @return The current list.
+         */
+        OffsetList &operator=(const OffsetList &obj) = delete;
+
+        /**
+         * @brief Default dtor, the region is released by the derived classes.
+         */
+        virtual ~OffsetList() = default;
+
+        /**
+         * @brief Return the number of values in the list.
+         * @return Number of values in the list.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Check if the list is empty.
+         * @return true if the list is empty, false otherwise.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Return the number of slots of the region.
+         * @return The capacity.
+         */
+        size_t capacity() const;
+
+        /**
+         * @brief Return the first value. If the list is empty an error occurs.
+         * @return The first value.
+         */
+        T front() const;
+
+        /**
+         * @brief Return the last value. If the list is empty an error occurs.
+         * @return The last value.
+         */
+        T back() const;
+
+        /**
+         * @brief Add a value to the back of the list.
+         * @param[in] value The value.
+         * @return True if the value has been added, false if the region is full.
+         */
+        bool add_back(const T &value);
+
+        /**
+         * @brief Add a value to the front of the list.
+         * @param[in] value The value.
+         * @return True if the value has been added, false if the region is full.
+         */
+        bool add_front(const T &value);
+
+        /**
+         * @brief Add a value before the first greater value, like
+         * OrderedList::add, so that a list filled only by add stays ordered.
+         * @param[in] value The value.
+         * @return True if the value has been added, false if the region is full.
+         */
+        bool add(const T &value);
+
+        /**
+         * @brief Remove the first value. If the list is empty an error occurs.
+         * @return The removed value.
+         */
+        T remove_front();
+
+        /**
+         * @brief Remove the last value. If the list is empty an error occurs.
+         * @return The removed value.
+         */
+        T remove_back();
+
+        /**
+         * @brief Remove the first value equal to value.
+         * @param[in] value The value to remove.
+         * @return True if a value has been removed, false otherwise.
+         */
+        bool remove_value(const T &value);
+
+        /**
+         * @brief Pass the first count values, or all of them if they are fewer, to
+         * function in their slots, without copying them out, and remove them.
+         * @tparam Function A callable with a const T& param.
+         * @param[in] count The number of values to remove.
+         * @param[in] function The function called on each value before it's
+         * removed.
+         * @return The number of values removed.
+         */
+        template<typename Function>
+        size_t consume_front(size_t count, Function &&function);
+
+        /**
+         * @brief Apply function to all values in the list, from the first.
+         * @tparam Function A callable with a const T& param.
+         * @param[in] function The function to apply.
+         */
+        template<typename Function>
+        void apply(Function &&function) const;
+
+        /**
+         * @brief Return a vector with the values in list order.
+         * @return The values.
+         */
+        std::vector<T> to_vector() const;
+
+    protected:
+        /**
+         * @brief Create a list not bound to a region yet.
+         */
+        OffsetList() = default;
+
+        /**
+         * @brief Bind the list to a region checked by valid or written by format.
+         * It's called again when the region is mapped somewhere else.
+         * @param[in] region The region.
+         */
+        void attach(void *region);
+
+        /**
+         * @brief Make the region larger when all the slots are used, and attach
+         * the list to it. The default region can't grow.
+         * @return True if there are free slots now, false otherwise.
+         */
+        virtual bool grow();
+
+        /**
+         * @brief Return the header of the region.
+         * @return The header.
+         */
+        Header &header() const;
+
+        /**
+         * @brief Rebuild the list from its forward ring, like after a process
+         * died while changing it: the previous links and the size are set from
+         * the ring, and the used slots out of the ring, like a slot taken but not
+         * linked yet, go back to the free list. The forward ring is valid if it
+         * reaches the sentinel through distinct used slots.
+         * @return True if the list has been rebuilt, false if the forward ring
+         * is not valid.
+         */
+        bool repair() const;
+
+    private:
+        /**
+         * @brief Return the offset of the slots from the beginning of the region.
+         * @return The offset in bytes.
+         */
+        static constexpr size_t slots_offset();
+
+        /**
+         * @brief Return the links at offset from links.
+         * @param[in] links Links in the region.
+         * @param[in] offset A self-relative offset.
+         * @return The links.
+         */
+        static Links *follow(const Links *links, int64_t offset);
+
+        /**
+         * @brief Return the offset that reaches to from from.
+         * @param[in] from The links that hold the offset.
+         * @param[in] to The links to reach.
+         * @return The self-relative offset.
+         */
+        static int64_t offset(const Links *from, const Links *to);
+
+        /**
+         * @brief Take a free slot, growing the region if needed.
+         * @return The slot, nullptr if the region is full.
+         */
+        Slot *acquire();
+
+        /**
+         * @brief Link slot before pos.
+         * @param[in] pos A slot of the list or the sentinel.
+         * @param[in] slot A slot not linked.
+         */
+        void link(Links *pos, Slot *slot);
+
+        /**
+         * @brief Unlink slot, push it in the free list and return its value.
+         * @param[in] slot A slot of the list.
+         * @return The value of the slot.
+         */
+        T release(Slot *slot);
+
+        /**
+         * @brief Return the slot i of the array.
+         * @param[in] i The index.
+         * @return The slot.
+         */
+        Slot *slot(uint64_t i) const;
+
+        /**
+         * @brief Return the index of a slot of the array.
+         * @param[in] slot The slot.
+         * @return The index.
+         */
+        uint64_t index(const Slot *slot) const;
+
+        char *_region{nullptr}; /**<  The region, where the header starts. */
+    };
+
+} // namespace simple_list
+
+#include "impl/OffsetList.i.hpp"
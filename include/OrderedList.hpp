@@ -32,7 +32,10 @@
 
 #pragma once
 
-#include "List.hpp"
+#include "ListBase.hpp"
+#include "ListSort.hpp"
+#include "ThreadPool.hpp"
+#include <string>
 
 namespace simple_list {
 
@@ -41,47 +44,151 @@ namespace simple_list {
  * @tparam T Type of the list.
  */
     template<typename T>
-    class OrderedList : public List<T> {
+    class OrderedList : public ListBase<OrderedList<T>, T> {
     public:
         /**
          * @brief Default ctor
          */
         explicit OrderedList() = default;
 
+        /**
+         * @brief Create an empty list whose nodes are taken from resource, like
+         * a std::pmr container. The nodes added by the caller are still owned by
+         * the caller.
+         * @param[in] resource The resource, that must outlive the list.
+         */
+        explicit OrderedList(MemoryResource *resource);
+
         /**
          * @brief Default dtor.
          */
         ~OrderedList() override = default;
 
+        /**
+         * @brief Create a new list with the values stored in array. The nodes are
+         * linked in array order and then sorted at once, so integral and floating
+         * point values are loaded in linear time.
+         * @param[in] array The array of values.
+         * @param[in] size Size of the array.
+         * @return The new list.
+         */
+        static OrderedList<T> *create_from_array(T *array, size_t size);
+
+        /**
+         * @brief Create a new list with the values stored in array, in nodes
+         * taken from resource instead of the global heap.
+         * @param[in] array The array of values.
+         * @param[in] size Size of the array.
+         * @param[in] resource The resource, that must outlive the list.
+         * @return The new list.
+         */
+        static OrderedList<T> *create_from_array(T *array, size_t size, MemoryResource *resource);
+
+        /**
+         * @brief Create a new list with the values saved by List::save in the
+         * file path. The nodes are created in the pool of the list and linked in
+         * one pass. The stored order is checked, not sorted again, so loading is linear. If the file can't be loaded an error occurs.
+         * @param[in] path The path of the file.
+         * @return The new list, nullptr if the file can't be loaded.
+         */
+        static OrderedList<T> *load(const std::string &path);
+
+        /**
+         * @brief Redo on the list the mutations recorded in the log in the file
+         * path, in order, usually after loading the snapshot the log was started
+         * from. The removed nodes are released if the list owns them. If the log
+         * can't be read, holds mutations of an UnorderedList or a removal doesn't
+         * match the list an error occurs, and the mutations before it are kept.
+         * Needs MutationLog.hpp.
+         * @param[in] path The path of a file written by MutationLog.
+         * @return True if all the mutations have been redone, false otherwise.
+         */
+        bool replay(const std::string &path);
+
+        /**
+         * @brief Create a new list with the values stored in array using the
+         * threads of pool. Every thread creates and sorts the nodes of a slice of
+         * the array, then the slices are merged pairwise in parallel. The nodes
+         * are on the global heap. It must not be called from a task of pool,
+         * that would deadlock.
+         * @param[in] array The array of values.
+         * @param[in] size Size of the array.
+         * @param[in] pool The pool that builds the list.
+         * @return The new list.
+         */
+        static OrderedList<T> *create_from_array(T *array, size_t size, ThreadPool &pool);
+
+        /**
+         * @brief Create a new list with the values stored in array using the
+         * threads of pool, in nodes taken from resource. The pool of the list is
+         * not thread safe, so the nodes are created by the calling thread and
+         * only the slices are sorted and merged by the workers.
+         * @param[in] array The array of values.
+         * @param[in] size Size of the array.
+         * @param[in] pool The pool that sorts the list.
+         * @param[in] resource The resource, that must outlive the list.
+         * @return The new list.
+         */
+        static OrderedList<T> *create_from_array(T *array, size_t size, ThreadPool &pool, MemoryResource *resource);
+
         void add(Node<T> &node) override;
 
+        /**
+         * @brief Construct a value in place from args in a node of the pool of the
+         * list and insert it in order. The node is released with the list.
+         * @tparam Args The types of the arguments of the constructor of T.
+         * @param[in] args The arguments of the constructor of T.
+         * @return The new node.
+         */
+        template<typename... Args>
+        Node<T> &emplace(Args &&... args);
+
         /**
          * @brief Remove the first node with value equal to value.
          * @param[in] value The value to search.
-         * @return The node with the value searched.
+         * @return The removed node, or nullptr if no node has the value.
          */
-        Node<T> &remove_value(T value);
+        Node<T> *remove_value(const T &value);
 
         Node<T> &remove_front() override;
 
     protected:
     private:
         /**
-         * @brief Auxiliary add function that compares the current node cur and the
-         * node to insert.
-         * @param[in] cur The current node.
-         * @param[in] node The node to insert.
+         * @brief Create a chain of new nodes with the values stored in array, in
+         * array order.
+         * @tparam Create A callable with a const T& param that returns a new
+         * Node<T>*.
+         * @param[in] array The array of values, not empty.
+         * @param[in] size Size of the array.
+         * @param[out] first The first node of the chain.
+         * @param[out] last The last node of the chain.
+         * @param[in] create The function that creates a node.
+         */
+        template<typename Create>
+        static void link_chain(T *array, size_t size, Node<T> *&first, Node<T> *&last, Create create);
+
+        /**
+         * @brief Create a sorted chain of new nodes with the values stored in
+         * array.
+         * @tparam Create A callable with a const T& param that returns a new
+         * Node<T>*.
+         * @param[in] array The array of values, not empty.
+         * @param[in] size Size of the array.
+         * @param[out] first The first node of the chain.
+         * @param[out] last The last node of the chain.
+         * @param[in] create The function that creates a node.
          */
-        void add_aux(Node<T> &cur, Node<T> &node);
+        template<typename Create>
+        static void create_chain(T *array, size_t size, Node<T> *&first, Node<T> *&last, Create create);
 
         /**
-         * @brief Auxiliary remove_value function that compares the current node cur
-         * and the value to find.
-         * @param[in] cur The current node.
-         * @param[in] value The value to compare.
-         * @return The removed node.
+         * @brief Create a node on the global heap, owned by the lists created with
+         * create_from_array.
+         * @param[in] value The value.
+         * @return The new node.
          */
-        Node<T> &remove_value_aux(Node<T> &cur, T value);
+        static Node<T> *new_node(const T &value);
     };
 
 } // namespace simple_list
@@ -0,0 +1,157 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+#pragma once
+
+namespace simple_list {
+
+/**
+ * @brief The links of an element of a ring closed by a sentinel, without
+ * payload: the pointer manipulation shared by NodeBase and ListHook. It has no
+ * accessor that casts a link to a Node, since the links of a ListHook belong to
+ * user objects. A link is valid if it isn't null.
+ * @tparam Derived The type of the linked elements, that derives from RingLinks.
+ */
+    template<typename Derived>
+    class RingLinks {
+    public:
+        /**
+         * @brief Create links not set.
+         */
+        RingLinks() = default;
+
+        /**
+         * @brief Default copy constructor
+         * @param[in] obj The other object.
+         */
+        RingLinks(const RingLinks &obj) = default;
+
+        /**
+         * @brief Copy the links of obj.
+         * @param[in] obj The other links.
+         * @return The current links.
+         */
+        RingLinks &operator=(const RingLinks &obj) = default;
+
+        /**
+         * @brief Unset the pointers to the next and previous element.
+         */
+        void clear();
+
+        /**
+         * @brief Unset the pointer to the previous element.
+         */
+        void clear_prev();
+
+        /**
+         * @brief Unset the pointer to the next element.
+         */
+        void clear_next();
+
+        /**
+         * @brief Check if the element has a next link. In a ring the last element
+         * links to the sentinel.
+         * @return True if the element has a valid next link, false otherwise.
+         */
+        bool has_next() const;
+
+        /**
+         * @brief Check if the element has a previous link. In a ring the first
+         * element links to the sentinel.
+         * @return True if the element has a valid previous link, false otherwise.
+         */
+        bool has_prev() const;
+
+        /**
+         * @brief Return the next link, that can be a sentinel.
+         * @return The next link, null if not set.
+         */
+        Derived *next_link() const;
+
+        /**
+         * @brief Return the previous link, that can be a sentinel.
+         * @return The previous link, null if not set.
+         */
+        Derived *prev_link() const;
+
+        /**
+         * @brief Insert the current element between prev and next, that must be
+         * adjacent.
+         * @param[in] prev The element that goes before.
+         * @param[in] next The element that goes after.
+         */
+        void link(Derived &prev, Derived &next);
+
+        /**
+         * @brief Remove the current element from the ring it belongs to and clear
+         * its links.
+         */
+        void unlink();
+
+        /**
+         * @brief Link the current element to itself, as the sentinel of an empty
+         * ring. The other elements are not updated.
+         */
+        void reset();
+
+        /**
+         * @brief Walk the ring closed by sentinel from the first element and
+         * return the first one for which before holds: the position where an
+         * ordered insert links the new element.
+         * @tparam Predicate A callable with a Derived& param that returns bool.
+         * @param[in] sentinel The sentinel of the ring.
+         * @param[in] before The predicate, true if the new element goes before
+         * the param.
+         * @return The first element that satisfies before, or sentinel if none.
+         */
+        template<typename Predicate>
+        static Derived *find_if(Derived &sentinel, Predicate before);
+
+    protected:
+        /**
+         * @brief Default dtor, elements are never deleted through their links.
+         */
+        ~RingLinks() = default;
+
+        Derived *_next{nullptr}; /**<  The next element, null if not set. */
+        Derived *_prev{nullptr}; /**<  The previous element, null if not set. */
+
+    private:
+        /**
+         * @brief Return the current element as a Derived.
+         * @return The current element.
+         */
+        Derived *self();
+    };
+
+} // namespace simple_list
+
+#include "impl/RingLinks.i.hpp"
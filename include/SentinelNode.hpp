@@ -29,60 +29,48 @@
  *
  * @file
  */
-
 #pragma once
 
-#include "Node.hpp"
+#include "NodeBase.hpp"
 
 namespace simple_list {
-    template<typename T>
-    class Node;
 
 /**
- * @brief A special node to mark the head and the tail of the list.
+ * @brief A special node that closes the ring of the nodes of a list: its next
+ * node is the first of the list and its previous node is the last. It only has
+ * the links, so it doesn't store a value of type T.
  * @tparam T The type of the node.
+ * @tparam Check The checking policy of the links.
  */
-    template<typename T>
-    class SentinelNode : public Node<T> {
+    template<typename T, typename Check = DefaultCheck>
+    class SentinelNode : public NodeBase<T, Check> {
 
     public:
         /**
-         * @brief Possible types for the sentinel node.
+         * @brief Create the sentinel of an empty list, linked to himself.
          */
-        enum SENTINEL_TYPE {
-            NOT_SET,
-            HEAD,
-            TAIL
-        };
+        SentinelNode();
 
         /**
-         * @brief Create a new sentinel of selected type.
-         * @param[in] type Type of the sentinel node.
-         */
-        explicit SentinelNode(SENTINEL_TYPE type);
-
-        /**
-         * @brief Default copy constructor
+         * @brief The sentinel is bound to the address of its list, so it can't be
+         * copied.
          * @param[in] obj The other object.
          */
-        SentinelNode(const SentinelNode &obj) = default;
+        SentinelNode(const SentinelNode &obj) = delete;
 
         /**
-         * @brief Set obj as next node if the type is HEAD, as previous if the type
-         * is TAIL.
-         * @param[in] obj The node to attach.
-         */
-        void set(Node<T> &obj);
-
-        /**
-         * @brief Assign the sentinel always to himself.
+         * @brief The sentinel is bound to the address of its list, so it can't be
+         * assigned.
          * @param[in] obj The other sentinel node.
          * @return The sentinel node himself.
          */
-        SentinelNode<T> &operator=(const SentinelNode<T> &obj);
+        SentinelNode<T, Check> &operator=(const SentinelNode<T, Check> &obj) = delete;
 
-    protected:
-        SENTINEL_TYPE _type{NOT_SET}; /**< The type of the sentinel. */
+        /**
+         * @brief Check if the sentinel is linked to himself.
+         * @return True if the ring has no nodes, false otherwise.
+         */
+        bool empty() const;
     };
 } // namespace simple_list
 
@@ -0,0 +1,259 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include "OffsetList.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+namespace simple_list {
+
+/**
+ * @brief A list in a POSIX shared memory segment, so that processes on the same
+ * host exchange values through it without serializing them: a producer adds
+ * values to the back and a consumer removes them from the front, or reads them
+ * in place with consume_front. The slots and the self-relative links are the
+ * ones of OffsetList, so each process can map the segment at a different
+ * address. The capacity is fixed when the segment is created, because the
+ * other processes can't follow a remapping.
+ *
+ * Every operation holds a process-shared robust mutex that lives in the
+ * segment before the list. If a process dies holding it, the next one rebuilds
+ * the previous links, the size and the free list from the forward ring and
+ * takes the mutex over, so a process that dies in the middle of an operation
+ * loses at most that operation. Only if the forward ring itself is damaged is
+ * the mutex left not recoverable and the segment broken for all the
+ * processes. When the mutex can't be taken an error occurs and the operation
+ * does nothing: size returns 0, empty true, wait false and so on. wait blocks a
+ * consumer until a value is added.
+ * @tparam T The type of the values, trivially copyable.
+ */
+    template<typename T>
+    class SharedList : private OffsetList<T> {
+    public:
+        /**
+         * @brief Create the segment name, that must not exist, with an empty list
+         * of capacity slots. If it can't be created an error occurs.
+         * @param[in] name The name of the segment, like "/queue".
+         * @param[in] capacity The number of slots.
+         * @return The list, nullptr if the segment can't be created.
+         */
+        static SharedList<T> *create(const std::string &name, uint64_t capacity);
+
+        /**
+         * @brief Open the list of the segment name, created by create. If the
+         * segment doesn't exist or doesn't hold a list of T an error occurs.
+         * @param[in] name The name of the segment.
+         * @return The list, nullptr if the segment can't be opened.
+         */
+        static SharedList<T> *open(const std::string &name);
+
+        /**
+         * @brief Remove the name of the segment. The processes that opened it keep
+         * it until they close it. If it fails an error occurs.
+         * @param[in] name The name of the segment.
+         * @return True if the name has been removed, false otherwise.
+         */
+        static bool destroy(const std::string &name);
+
+        /**
+         * @brief Unmap the segment. The list stays in the segment for the other
+         * processes.
+         */
+        ~SharedList() override;
+
+        /**
+         * @brief Return the number of values in the list.
+         * @return Number of values in the list.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Check if the list is empty.
+         * @return true if the list is empty, false otherwise.
+         */
+        bool empty() const;
+
+        using OffsetList<T>::capacity;
+
+        /**
+         * @brief Add a value to the back of the list and wake the waiting
+         * consumers.
+         * @param[in] value The value.
+         * @return True if the value has been added, false if the list is full.
+         */
+        bool add_back(const T &value);
+
+        /**
+         * @brief Add count values to the back of the list while holding the lock
+         * once, until the list is full.
+         * @param[in] values The values.
+         * @param[in] count The number of values.
+         * @return The number of values added.
+         */
+        size_t add_back(const T *values, size_t count);
+
+        /**
+         * @brief Remove the first value.
+         * @param[out] value The removed value.
+         * @return True if a value has been removed, false if the list is empty.
+         */
+        bool remove_front(T &value);
+
+        /**
+         * @brief Remove up to count values from the front while holding the lock
+         * once.
+         * @param[out] values The removed values, room for count.
+         * @param[in] count The maximum number of values.
+         * @return The number of values removed.
+         */
+        size_t remove_front(T *values, size_t count);
+
+        /**
+         * @brief Pass up to count values from the front to function in the
+         * segment, without copying them out, and remove them. The lock is held
+         * while function runs.
+         * @tparam Function A callable with a const T& param.
+         * @param[in] count The maximum number of values.
+         * @param[in] function The function called on each value.
+         * @return The number of values removed.
+         */
+        template<typename Function>
+        size_t consume_front(size_t count, Function &&function);
+
+        /**
+         * @brief Wait until the list is not empty, or milliseconds have passed.
+         * @param[in] milliseconds The maximum time to wait.
+         * @return True if the list is not empty, false otherwise.
+         */
+        bool wait(uint32_t milliseconds) const;
+
+        /**
+         * @brief Return a vector with the values in list order.
+         * @return The values.
+         */
+        std::vector<T> to_vector() const;
+
+    private:
+        /**
+         * @brief The beginning of the segment, before the list.
+         */
+        struct Control {
+            char magic[4]; /**< "SLSH", written when the segment is ready. */
+            pthread_mutex_t mutex; /**< The lock of every operation. */
+            pthread_cond_t added; /**< Signaled when values are added. */
+        };
+
+        /**
+         * @brief Hold the mutex of the segment for the lifetime of the guard, if
+         * it can be locked. A mutex left locked by a dead process is made
+         * consistent only if the list can be repaired.
+         */
+        class Guard {
+        public:
+            /**
+             * @brief Lock the mutex of list. If it can't be locked an error
+             * occurs.
+             * @param[in] list The list of the segment.
+             */
+            explicit Guard(const SharedList<T> &list);
+
+            /**
+             * @brief The guard owns the lock, so it can't be copied.
+             * @param[in] obj The other guard.
+             */
+            Guard(const Guard &obj) = delete;
+
+            /**
+             * @brief The guard owns the lock, so it can't be assigned.
+             * @param[in] obj The other guard.
+             * @return The current guard.
+             */
+            Guard &operator=(const Guard &obj) = delete;
+
+            /**
+             * @brief Unlock the mutex, if it's held.
+             */
+            ~Guard();
+
+            /**
+             * @brief Check if the guard holds the mutex.
+             * @return True if the mutex is held, false otherwise.
+             */
+            bool locked() const;
+
+            /**
+             * @brief Take the result of a call that locks the mutex, like
+             * pthread_mutex_lock or pthread_cond_timedwait. If the owner died
+             * the list is repaired, and if it can't be the mutex is unlocked
+             * without being made consistent, so it can't be locked anymore. If
+             * the mutex isn't held an error occurs.
+             * @param[in] result The result of the call.
+             * @return True if the mutex is held, false otherwise.
+             */
+            bool acquire(int result);
+
+        private:
+            const SharedList<T> &_list; /**<  The list of the segment. */
+            bool _locked; /**<  True while the mutex is held. */
+        };
+
+        /**
+         * @brief Return the offset of the list from the beginning of the segment.
+         * @return The offset in bytes, a multiple of a cache line.
+         */
+        static constexpr size_t region_offset();
+
+        /**
+         * @brief Create a list bound to a mapped segment.
+         * @param[in] mapping The mapping of the segment.
+         * @param[in] bytes The size of the mapping.
+         */
+        SharedList(void *mapping, size_t bytes);
+
+        /**
+         * @brief Return the control block of the segment.
+         * @return The control block.
+         */
+        Control &control() const;
+
+        void *_mapping; /**<  The mapping of the segment. */
+        size_t _bytes; /**<  The size of the mapping. */
+    };
+
+} // namespace simple_list
+
+#include "impl/SharedList.i.hpp"
@@ -0,0 +1,102 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace simple_list {
+
+/**
+ * @brief A fixed set of worker threads that run the submitted tasks in FIFO
+ * order. The pool is meant to be created once and reused by the parallel
+ * algorithms of the lists.
+ *
+ * The parallel algorithms wait for the tasks they submit, so they must not be
+ * called from a task of the same pool: once every worker waits, the tasks they
+ * wait for are never run and the pool deadlocks.
+ */
+    class ThreadPool {
+    public:
+        /**
+         * @brief Create a pool with the given number of workers.
+         * @param[in] threads Number of workers, at least one. By default one per
+         * hardware thread.
+         */
+        explicit ThreadPool(size_t threads = std::thread::hardware_concurrency());
+
+        /**
+         * @brief Run the pending tasks and join the workers.
+         */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &obj) = delete;
+
+        ThreadPool &operator=(const ThreadPool &obj) = delete;
+
+        /**
+         * @brief Return the number of workers.
+         * @return The number of workers.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Queue a task.
+         * @tparam F A callable without parameters.
+         * @param[in] task The task to run.
+         * @return A future that holds the result of the task or its exception.
+         */
+        template<typename F>
+        auto submit(F &&task) -> std::future<decltype(task())>;
+
+    private:
+        /**
+         * @brief Loop of a worker: pop and run tasks until the pool is stopped.
+         */
+        void work();
+
+        std::vector<std::thread> _workers; /**< The worker threads. */
+        std::queue<std::function<void()>> _tasks; /**< The pending tasks. */
+        std::mutex _mutex; /**< Protects _tasks and _stop. */
+        std::condition_variable _ready; /**< Signals new tasks or stop. */
+        bool _stop{false}; /**< True when the pool is being destroyed. */
+    };
+
+} // namespace simple_list
+
+#include "impl/ThreadPool.i.hpp"
@@ -32,13 +32,15 @@
 
 #pragma once
 
-#include "List.hpp"
+#include "ListBase.hpp"
+#include "ListSort.hpp"
+#include "NodeIndex.hpp"
+#include "ThreadPool.hpp"
+#include <memory>
+#include <string>
 
 namespace simple_list {
 
-    template<typename T>
-    class Node;
-
     template<typename T>
     class List;
 
@@ -47,14 +49,27 @@ namespace simple_list {
  * @tparam T The type of the list.
  */
     template<typename T>
-    class UnorderedList : public List<T> {
+    class UnorderedList : public ListBase<UnorderedList<T>, T> {
     public:
         /**
          * @brief Default ctor
          */
         explicit UnorderedList() = default;
 
-        ~UnorderedList() override;
+        /**
+         * @brief Create an empty list whose nodes are taken from resource, like
+         * a std::pmr container. The nodes added by the caller are still owned by
+         * the caller.
+         * @param[in] resource The resource, that must outlive the list.
+         */
+        explicit UnorderedList(MemoryResource *resource);
+
+        /**
+         * @brief Default dtor.
+         */
+        ~UnorderedList() override = default;
+
+        using List<T>::transform_values;
 
         /**
          * @brief Create a new list with the values stored in array.
@@ -64,6 +79,37 @@ namespace simple_list {
          */
         static UnorderedList<T> *create_from_array(T *array, size_t size);
 
+        /**
+         * @brief Create a new list with the values stored in array, in nodes
+         * taken from resource instead of the global heap.
+         * @param[in] array The array of values.
+         * @param[in] size Size of the array.
+         * @param[in] resource The resource, that must outlive the list.
+         * @return The new list.
+         */
+        static UnorderedList<T> *create_from_array(T *array, size_t size, MemoryResource *resource);
+
+        /**
+         * @brief Create a new list with the values saved by List::save in the
+         * file path. The nodes are created in the pool of the list and linked in
+         * one pass. If the file can't be loaded an error occurs.
+         * @param[in] path The path of the file.
+         * @return The new list, nullptr if the file can't be loaded.
+         */
+        static UnorderedList<T> *load(const std::string &path);
+
+        /**
+         * @brief Redo on the list the mutations recorded in the log in the file
+         * path, in order, usually after loading the snapshot the log was started
+         * from. The removed nodes are released like by discard. If the log can't
+         * be read or a removal doesn't match the list an error occurs, and the
+         * mutations before it are kept.
+         * Needs MutationLog.hpp.
+         * @param[in] path The path of a file written by MutationLog.
+         * @return True if all the mutations have been redone, false otherwise.
+         */
+        bool replay(const std::string &path);
+
         void add(Node<T> &node) override;
 
         /**
@@ -78,6 +124,68 @@ namespace simple_list {
          */
         void add_front(Node<T> &node);
 
+        /**
+         * @brief Same as emplace_back.
+         * @tparam Args The types of the arguments of the constructor of T.
+         * @param[in] args The arguments of the constructor of T.
+         * @return The new node.
+         */
+        template<typename... Args>
+        Node<T> &emplace(Args &&... args);
+
+        /**
+         * @brief Construct a value in place from args in a node of the pool of the
+         * list and add it to the back of the list. The node is released by
+         * remove_if, unique and dedup, or with the list.
+         * @tparam Args The types of the arguments of the constructor of T.
+         * @param[in] args The arguments of the constructor of T.
+         * @return The new node.
+         */
+        template<typename... Args>
+        Node<T> &emplace_back(Args &&... args);
+
+        /**
+         * @brief Construct a value in place from args in a node of the pool of the
+         * list and add it to the front of the list. The node is released by
+         * remove_if, unique and dedup, or with the list.
+         * @tparam Args The types of the arguments of the constructor of T.
+         * @param[in] args The arguments of the constructor of T.
+         * @return The new node.
+         */
+        template<typename... Args>
+        Node<T> &emplace_front(Args &&... args);
+
+        /**
+         * @brief Replace the values of the list with the size values of array.
+         * The nodes already in the list are reused in list order, the missing
+         * ones are created by emplace_back after a reserve, and the extra ones
+         * are removed from the back and released like by discard. A log records
+         * the removal of all the old values and the addition of the new ones.
+         * @param[in] array The values.
+         * @param[in] size The number of values.
+         */
+        void assign_from(const T *array, size_t size);
+
+        /**
+         * @brief Add an already linked chain of nodes to the back of the list in
+         * O(1). With the index enabled the nodes of the chain are also indexed.
+         * @param[in] first The first node of the chain.
+         * @param[in] last The last node of the chain, reachable from first with
+         * next().
+         * @param[in] count The number of nodes of the chain.
+         */
+        void add_back_chain(Node<T> &first, Node<T> &last, int32_t count);
+
+        /**
+         * @brief Add an already linked chain of nodes to the front of the list in
+         * O(1). With the index enabled the nodes of the chain are also indexed.
+         * @param[in] first The first node of the chain.
+         * @param[in] last The last node of the chain, reachable from first with
+         * next().
+         * @param[in] count The number of nodes of the chain.
+         */
+        void add_front_chain(Node<T> &first, Node<T> &last, int32_t count);
+
         /**
          * @brief Remove the last element of the list
          * @return The remove node.
@@ -87,11 +195,154 @@ namespace simple_list {
         Node<T> &remove_front() override;
 
         /**
-         * @brief Remove the node in position index.
+         * @brief Remove the node in position index. If index is out of range an
+         * error occurs and nothing is removed or logged.
          * @param[in] index The position of the node in the list. Starts from zero.
+         * @return The removed node, nullptr if index is out of range.
+         */
+        Node<T> *remove(int32_t index);
+
+        /**
+         * @brief Remove node from the list in O(1).
+         * @param[in] node A node of the list.
          * @return The removed node.
          */
-        Node<T> &remove(int32_t index);
+        Node<T> &remove(Node<T> &node);
+
+        /**
+         * @brief Move node to the front of the list in O(1).
+         * @param[in] node A node of the list.
+         */
+        void move_to_front(Node<T> &node);
+
+        /**
+         * @brief Find a node with the given value. With the index enabled it runs
+         * in expected O(1), otherwise the list is scanned from the front.
+         * @param[in] value The value to search.
+         * @return A node with the value, nullptr if there isn't one.
+         */
+        Node<T> *find(const T &value);
+
+        /**
+         * @brief Remove a node with the given value. With the index enabled it
+         * runs in expected O(1), but the node is not always the first with the
+         * value: a log then records the position of the node, found by walking
+         * the list back from it, so that replay removes the same node.
+         * @param[in] value The value to search.
+         * @return The removed node, nullptr if the value is not found.
+         */
+        Node<T> *remove_value(const T &value);
+
+        /**
+         * @brief Remove the nodes whose value is equal to the value of the node
+         * before them, in one traversal and without allocating. The removed nodes
+         * are deleted if the list has been created with create_from_array.
+         * @return The number of removed nodes.
+         */
+        int32_t unique();
+
+        /**
+         * @brief Remove the nodes whose value is equal to the value of any node
+         * before them, in one traversal with a transient open addressing hash
+         * set. The removed nodes are deleted if the list has been created with
+         * create_from_array.
+         * @return The number of removed nodes.
+         */
+        int32_t dedup();
+
+        /**
+         * @brief Remove all the nodes whose value satisfies pred, in one
+         * traversal. The removed nodes are deleted if the list has been created
+         * with create_from_array.
+         * @tparam Predicate A callable that takes a value and returns bool.
+         * @param[in] pred The predicate.
+         * @return The number of removed nodes.
+         */
+        template<typename Predicate>
+        int32_t remove_if(Predicate pred);
+
+        /**
+         * @brief Move all the nodes whose value satisfies pred, in order, to a new
+         * list, in one traversal. The new list owns the nodes if this list did.
+         * @tparam Predicate A callable that takes a value and returns bool.
+         * @param[in] pred The predicate.
+         * @return The new list with the extracted nodes.
+         */
+        template<typename Predicate>
+        UnorderedList<T> *extract_if(Predicate pred);
+
+        /**
+         * @brief Reorder the list so that the nodes whose value satisfies pred
+         * come before the others. The partition is stable and it's done in one
+         * traversal by relinking.
+         * @tparam Predicate A callable that takes a value and returns bool.
+         * @param[in] pred The predicate.
+         * @return The number of nodes that satisfy pred.
+         */
+        template<typename Predicate>
+        int32_t partition(Predicate pred);
+
+        /**
+         * @brief Build a hash index from the values to the nodes of the list. The
+         * index is kept up to date by the add and remove functions. The value of
+         * a node must not change while the node is indexed: call enable_index()
+         * again to rebuild the index after changing values.
+         * @tparam Hash The hash function of the values.
+         */
+        template<typename Hash = std::hash<T>>
+        void enable_index();
+
+        /**
+         * @brief Drop the hash index and free its memory.
+         */
+        void disable_index();
+
+        /**
+         * @brief Check if the hash index is enabled.
+         * @return true if the index is enabled, false otherwise.
+         */
+        bool indexed() const;
+
+        /**
+         * @brief Return the memory used by the hash index.
+         * @return The size of the index in bytes, zero if it isn't enabled.
+         */
+        size_t index_memory() const;
+
+        /**
+         * @brief Sort the list in ascending order of value. The sort is stable
+         * and it only relinks the nodes. Integral and floating point values are
+         * sorted in linear time with a radix sort.
+         */
+        void sort();
+
+        /**
+         * @brief Sort the list with a stable, in-place bottom-up merge sort that
+         * only relinks the nodes. No node is allocated or copied.
+         * @tparam Compare A strict weak ordering on values of type T.
+         * @param[in] comp Returns true if the first value goes before the second.
+         */
+        template<typename Compare>
+        void sort(Compare comp);
+
+        /**
+         * @brief Sort the list in ascending order of value using the threads of
+         * pool. The list is cut in one chunk per thread, the chunks are sorted
+         * concurrently and then merged pairwise in parallel by relinking. It
+         * waits for the chunks, so it must not run on a worker of pool.
+         * @param[in] pool The pool that runs the sort.
+         */
+        void parallel_sort(ThreadPool &pool);
+
+        /**
+         * @brief Stable parallel merge sort of the list using the threads of pool.
+         * It must not run on a worker of pool.
+         * @tparam Compare A strict weak ordering on values of type T.
+         * @param[in] pool The pool that runs the sort.
+         * @param[in] comp Returns true if the first value goes before the second.
+         */
+        template<typename Compare>
+        void parallel_sort(ThreadPool &pool, Compare comp);
 
     protected:
     private:
@@ -104,8 +355,55 @@ namespace simple_list {
          */
         Node<T> &remove_aux(int32_t index, Node<T> &node);
 
-        bool _allocated{false}; /**<  It's true if the list has been created with
-                               create_from_array. */
+        /**
+         * @brief Find the first node with the given value, scanning the list from
+         * the front.
+         * @param[in] value The value to search.
+         * @return The first node with the value, nullptr if there isn't one.
+         */
+        Node<T> *scan(const T &value);
+
+        /**
+         * @brief Unlink node from the list in O(1).
+         * @param[in] node A node of the list.
+         */
+        void unlink(Node<T> &node);
+
+        /**
+         * @brief Link node at the front of the list, without recording it in the
+         * log.
+         * @param[in] node The node to insert.
+         */
+        void link_front(Node<T> &node);
+
+        /**
+         * @brief Insert the nodes of the chain that goes from first to last in the
+         * index, if it is enabled.
+         * @param[in] first The first node of the chain.
+         * @param[in] last The last node of the chain.
+         */
+        void index_chain(Node<T> &first, Node<T> &last);
+
+        /**
+         * @brief Unlink node from the list and release it if the list owns it.
+         * @param[in] node A node of the list.
+         */
+        void discard(Node<T> &node);
+
+        /**
+         * @brief Auxiliary parallel sort that sorts the chunks with sort_chunk and
+         * merges them with comp.
+         * @tparam SortChunk A callable that sorts a chain given its first and last
+         * node.
+         * @tparam Compare A strict weak ordering on values of type T.
+         * @param[in] pool The pool that runs the sort.
+         * @param[in] sort_chunk The sort of a single chunk.
+         * @param[in] comp The comparison function used by the merges.
+         */
+        template<typename SortChunk, typename Compare>
+        void parallel_sort_aux(ThreadPool &pool, SortChunk sort_chunk, Compare comp);
+
+        std::unique_ptr<AbstractNodeIndex<T>> _index; /**<  The hash index, if enabled. */
     };
 
 } // namespace simple_list
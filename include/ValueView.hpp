@@ -0,0 +1,121 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include "ListIterator.hpp"
+#include "Node.hpp"
+#include <cstddef>
+#include <type_traits>
+
+namespace simple_list {
+
+/**
+ * @brief A view of the values of a list whose nodes are one after another in
+ * memory, in list order. The values are not copied: the value of index i is in
+ * the node i positions after the first, so the view is an array of values with
+ * a stride of sizeof(Node<T>) bytes. There is no data(): a pointer to the first
+ * value can't be indexed like an array, use operator[] or the iterators.
+ * @tparam T The type of the list.
+ * @tparam V T for a mutable view, const T for a constant one.
+ */
+    template<typename T, typename V>
+    class ValueView {
+    public:
+        using value_type = typename std::remove_const<V>::type; /**< The type of the values. */
+        using iterator = ListIterator<T, V>; /**< The iterator on the values. */
+
+        /**
+         * @brief The nodes the view reaches, const for a constant view.
+         */
+        using NodeType = typename std::conditional<std::is_const<V>::value,
+                const Node<T>, Node<T>>::type;
+
+        /**
+         * @brief Create an empty view.
+         */
+        ValueView() = default;
+
+        /**
+         * @brief Create a view of size values from the value of first.
+         * @param[in] first The first node, followed in memory by the others.
+         * @param[in] size The number of values.
+         * @param[in] end The end of the list, to iterate the view.
+         */
+        ValueView(NodeType *first, size_t size, iterator end);
+
+        /**
+         * @brief Return the number of values.
+         * @return The number of values.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Check if the view has no values.
+         * @return True if the view is empty, false otherwise.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Return the value of index i.
+         * @param[in] i The index, less than size().
+         * @return The value.
+         */
+        V &operator[](size_t i) const;
+
+        /**
+         * @brief Return the distance in bytes between two values.
+         * @return The stride.
+         */
+        static constexpr size_t stride();
+
+        /**
+         * @brief Return an iterator to the first value.
+         * @return The iterator.
+         */
+        iterator begin() const;
+
+        /**
+         * @brief Return an iterator past the last value.
+         * @return The iterator.
+         */
+        iterator end() const;
+
+    private:
+        NodeType *_first{nullptr}; /**<  The node of the first value. */
+        size_t _size{0}; /**<  The number of values. */
+        iterator _end; /**<  The end of the list. */
+    };
+
+} // namespace simple_list
+
+#include "impl/ValueView.i.hpp"
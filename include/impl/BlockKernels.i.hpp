@@ -0,0 +1,318 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#ifdef SIMPLE_LIST_AVX2
+#include <immintrin.h>
+#endif
+
+namespace simple_list {
+
+    template<typename T>
+    constexpr size_t BlockKernels<T>::block_size;
+
+    template<typename T>
+    constexpr size_t BlockKernels<T>::lanes;
+
+    template<typename T>
+    template<typename UnaryOp>
+    void BlockKernels<T>::transform(T *block, size_t size, UnaryOp &op) {
+#ifdef SIMPLE_LIST_AVX2
+        if (avx2()) {
+            transform_avx2(block, size, op);
+            return;
+        }
+#endif
+        transform_body(block, size, op);
+    }
+
+    template<typename T>
+    T BlockKernels<T>::sum(const T *block, size_t size) {
+#ifdef SIMPLE_LIST_AVX2
+        if (avx2()) {
+            return sum_avx2(block, size);
+        }
+#endif
+        return sum_body(block, size);
+    }
+
+    template<typename T>
+    T BlockKernels<T>::min(const T *block, size_t size) {
+#ifdef SIMPLE_LIST_AVX2
+        if (avx2()) {
+            return min_avx2(block, size);
+        }
+#endif
+        return min_body(block, size);
+    }
+
+    template<typename T>
+    T BlockKernels<T>::max(const T *block, size_t size) {
+#ifdef SIMPLE_LIST_AVX2
+        if (avx2()) {
+            return max_avx2(block, size);
+        }
+#endif
+        return max_body(block, size);
+    }
+
+    template<typename T>
+    template<typename Predicate>
+    size_t BlockKernels<T>::count_if(const T *block, size_t size, Predicate &pred) {
+#ifdef SIMPLE_LIST_AVX2
+        if (avx2()) {
+            return count_if_avx2(block, size, pred);
+        }
+#endif
+        return count_if_body(block, size, pred);
+    }
+
+    template<typename T>
+    bool BlockKernels<T>::avx2() {
+#ifdef SIMPLE_LIST_AVX2
+        static const bool supported = [] {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+        }();
+
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    template<typename T>
+    template<typename UnaryOp>
+    void BlockKernels<T>::transform_body(T *block, size_t size, UnaryOp &op) {
+        for (size_t i = 0; i < size; i++) {
+            block[i] = op(block[i]);
+        }
+    }
+
+    template<typename T>
+    T BlockKernels<T>::sum_body(const T *block, size_t size) {
+        T sums[lanes] = {};
+        size_t i = 0;
+
+        for (; i + lanes <= size; i += lanes) {
+            for (size_t j = 0; j < lanes; j++) {
+                sums[j] += block[i + j];
+            }
+        }
+
+        T result = T();
+
+        for (size_t j = 0; j < lanes; j++) {
+            result += sums[j];
+        }
+
+        for (; i < size; i++) {
+            result += block[i];
+        }
+
+        return result;
+    }
+
+    template<typename T>
+    T BlockKernels<T>::min_body(const T *block, size_t size) {
+        T lo[lanes];
+        size_t i = 0;
+
+        for (size_t j = 0; j < lanes; j++) {
+            lo[j] = block[0];
+        }
+
+        for (; i + lanes <= size; i += lanes) {
+            for (size_t j = 0; j < lanes; j++) {
+                lo[j] = block[i + j] < lo[j] ? block[i + j] : lo[j];
+            }
+        }
+
+        return finish_min(lo, block, i, size);
+    }
+
+    template<typename T>
+    T BlockKernels<T>::max_body(const T *block, size_t size) {
+        T hi[lanes];
+        size_t i = 0;
+
+        for (size_t j = 0; j < lanes; j++) {
+            hi[j] = block[0];
+        }
+
+        for (; i + lanes <= size; i += lanes) {
+            for (size_t j = 0; j < lanes; j++) {
+                hi[j] = hi[j] < block[i + j] ? block[i + j] : hi[j];
+            }
+        }
+
+        return finish_max(hi, block, i, size);
+    }
+
+    template<typename T>
+    template<typename Predicate>
+    size_t BlockKernels<T>::count_if_body(const T *block, size_t size, Predicate &pred) {
+        size_t count = 0;
+
+        for (size_t i = 0; i < size; i++) {
+            count += pred(block[i]) ? 1 : 0;
+        }
+
+        return count;
+    }
+
+    template<typename T>
+    T BlockKernels<T>::finish_min(const T *lo, const T *block, size_t from, size_t size) {
+        T result = lo[0];
+
+        for (size_t j = 1; j < lanes; j++) {
+            result = lo[j] < result ? lo[j] : result;
+        }
+
+        for (size_t i = from; i < size; i++) {
+            result = block[i] < result ? block[i] : result;
+        }
+
+        return result;
+    }
+
+    template<typename T>
+    T BlockKernels<T>::finish_max(const T *hi, const T *block, size_t from, size_t size) {
+        T result = hi[0];
+
+        for (size_t j = 1; j < lanes; j++) {
+            result = result < hi[j] ? hi[j] : result;
+        }
+
+        for (size_t i = from; i < size; i++) {
+            result = result < block[i] ? block[i] : result;
+        }
+
+        return result;
+    }
+
+#ifdef SIMPLE_LIST_AVX2
+
+    template<typename T>
+    template<typename UnaryOp>
+    void BlockKernels<T>::transform_avx2(T *block, size_t size, UnaryOp &op) {
+        transform_body(block, size, op);
+    }
+
+    template<typename T>
+    T BlockKernels<T>::sum_avx2(const T *block, size_t size) {
+        return sum_body(block, size);
+    }
+
+    template<typename T>
+    T BlockKernels<T>::min_avx2(const T *block, size_t size) {
+        return min_body(block, size);
+    }
+
+    template<typename T>
+    T BlockKernels<T>::max_avx2(const T *block, size_t size) {
+        return max_body(block, size);
+    }
+
+    template<typename T>
+    template<typename Predicate>
+    size_t BlockKernels<T>::count_if_avx2(const T *block, size_t size, Predicate &pred) {
+        return count_if_body(block, size, pred);
+    }
+
+    // The compiler doesn't vectorize the floating point selections of min_body
+    // and max_body, the instructions are spelled out.
+
+    template<>
+    SIMPLE_LIST_TARGET_AVX2 inline float BlockKernels<float>::min_avx2(const float *block, size_t size) {
+        __m256 lo = _mm256_set1_ps(block[0]);
+        size_t i = 0;
+
+        for (; i + lanes <= size; i += lanes) {
+            lo = _mm256_min_ps(_mm256_loadu_ps(block + i), lo);
+        }
+
+        alignas(32) float lo_lanes[lanes];
+        _mm256_store_ps(lo_lanes, lo);
+
+        return finish_min(lo_lanes, block, i, size);
+    }
+
+    template<>
+    SIMPLE_LIST_TARGET_AVX2 inline float BlockKernels<float>::max_avx2(const float *block, size_t size) {
+        __m256 hi = _mm256_set1_ps(block[0]);
+        size_t i = 0;
+
+        for (; i + lanes <= size; i += lanes) {
+            hi = _mm256_max_ps(_mm256_loadu_ps(block + i), hi);
+        }
+
+        alignas(32) float hi_lanes[lanes];
+        _mm256_store_ps(hi_lanes, hi);
+
+        return finish_max(hi_lanes, block, i, size);
+    }
+
+    template<>
+    SIMPLE_LIST_TARGET_AVX2 inline double BlockKernels<double>::min_avx2(const double *block, size_t size) {
+        __m256d lo = _mm256_set1_pd(block[0]);
+        size_t i = 0;
+
+        for (; i + lanes <= size; i += lanes) {
+            lo = _mm256_min_pd(_mm256_loadu_pd(block + i), lo);
+        }
+
+        alignas(32) double lo_lanes[lanes];
+        _mm256_store_pd(lo_lanes, lo);
+
+        return finish_min(lo_lanes, block, i, size);
+    }
+
+    template<>
+    SIMPLE_LIST_TARGET_AVX2 inline double BlockKernels<double>::max_avx2(const double *block, size_t size) {
+        __m256d hi = _mm256_set1_pd(block[0]);
+        size_t i = 0;
+
+        for (; i + lanes <= size; i += lanes) {
+            hi = _mm256_max_pd(_mm256_loadu_pd(block + i), hi);
+        }
+
+        alignas(32) double hi_lanes[lanes];
+        _mm256_store_pd(hi_lanes, hi);
+
+        return finish_max(hi_lanes, block, i, size);
+    }
+
+#endif
+
+} // namespace simple_list
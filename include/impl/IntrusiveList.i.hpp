@@ -0,0 +1,176 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+#pragma once
+
+#include <iostream>
+
+namespace simple_list {
+
+    template<typename T, typename Hook>
+    IntrusiveList<T, Hook>::IntrusiveList() {
+        _sentinel.reset();
+    }
+
+    template<typename T, typename Hook>
+    IntrusiveList<T, Hook>::~IntrusiveList() {
+        while (!empty()) {
+            remove_front();
+        }
+
+        // The sentinel is a hook too, that the policy checks is not linked when
+        // destroyed.
+        _sentinel.clear();
+    }
+
+    template<typename T, typename Hook>
+    int32_t IntrusiveList<T, Hook>::size() const { return _size; }
+
+    template<typename T, typename Hook>
+    bool IntrusiveList<T, Hook>::empty() const { return _size == 0; }
+
+    template<typename T, typename Hook>
+    T &IntrusiveList<T, Hook>::first() {
+        if (empty()) {
+            std::cerr << "Error: empty list\n";
+        }
+
+        return value_of(_sentinel.next_link());
+    }
+
+    template<typename T, typename Hook>
+    T &IntrusiveList<T, Hook>::last() {
+        if (empty()) {
+            std::cerr << "Error: empty list\n";
+        }
+
+        return value_of(_sentinel.prev_link());
+    }
+
+    template<typename T, typename Hook>
+    void IntrusiveList<T, Hook>::remove(T &value) {
+        if (!linked(value)) {
+            std::cerr << "Error: value not in a list\n";
+            return;
+        }
+
+        if (check_active<Check>::value) {
+            Check::check(contains(value), "value in another list");
+        }
+
+        unlink(value);
+    }
+
+    template<typename T, typename Hook>
+    T &IntrusiveList<T, Hook>::remove_front() {
+        T &value = first();
+        unlink(value);
+
+        return value;
+    }
+
+    template<typename T, typename Hook>
+    T &IntrusiveList<T, Hook>::remove_back() {
+        T &value = last();
+        unlink(value);
+
+        return value;
+    }
+
+    template<typename T, typename Hook>
+    bool IntrusiveList<T, Hook>::linked(const T &value) {
+        return Hook::to_hook(value).linked();
+    }
+
+    template<typename T, typename Hook>
+    template<typename Function>
+    void IntrusiveList<T, Hook>::apply(Function function) {
+        Link *link = _sentinel.next_link();
+
+        while (link != &_sentinel) {
+            T &value = value_of(link);
+            link = link->next_link();
+            function(value);
+        }
+    }
+
+    template<typename T, typename Hook>
+    typename IntrusiveList<T, Hook>::Link &IntrusiveList<T, Hook>::link_of(T &value) {
+        return Hook::to_hook(value);
+    }
+
+    template<typename T, typename Hook>
+    T &IntrusiveList<T, Hook>::value_of(Link *link) {
+        return Hook::to_value(*link);
+    }
+
+    template<typename T, typename Hook>
+    bool IntrusiveList<T, Hook>::contains(const T &value) const {
+        const Link *target = &Hook::to_hook(value);
+
+        for (const Link *link = _sentinel.next_link(); link != &_sentinel; link = link->next_link()) {
+            if (link == target) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template<typename T, typename Hook>
+    void IntrusiveList<T, Hook>::unlink(T &value) {
+        link_of(value).unlink();
+        _size--;
+    }
+
+    template<typename T, typename Hook>
+    void IntrusiveList<T, Hook>::insert(Link &pos, T &value) {
+        if (linked(value)) {
+            std::cerr << "Error: value already in a list\n";
+            return;
+        }
+
+        link_of(value).link(*pos.prev_link(), pos);
+        _size++;
+    }
+
+    template<typename T, typename Hook>
+    typename IntrusiveList<T, Hook>::Link &IntrusiveList<T, Hook>::front_link() {
+        return *_sentinel.next_link();
+    }
+
+    template<typename T, typename Hook>
+    template<typename Predicate>
+    typename IntrusiveList<T, Hook>::Link &IntrusiveList<T, Hook>::find_if(Predicate before) {
+        return *Link::find_if(_sentinel, [before](Link &link) { return before(value_of(&link)); });
+    }
+
+} // namespace simple_list
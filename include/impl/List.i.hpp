@@ -32,8 +32,34 @@
 
 #pragma once
 
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <utility>
+
 namespace simple_list {
 
+    template<typename T>
+    List<T>::~List() {
+        if (!_allocated || empty()) {
+            return;
+        }
+
+        // Iterative, so that very large lists can't overflow the stack. The
+        // nodes of the pool are destroyed with the pool.
+        Node<T> *node = &first();
+        for (int32_t i = 0; i < _size; i++) {
+            Node<T> *next = i + 1 < _size ? &node->next() : nullptr;
+
+            if (!_pool || !_pool->owns(node)) {
+                delete node;
+            }
+
+            node = next;
+        }
+    }
+
     template<typename T>
     constexpr int32_t List<T>::size() const { return _size; }
 
@@ -43,37 +69,617 @@ namespace simple_list {
     }
 
     template<typename T>
-    SentinelNode <T> &List<T>::head() { return _head; }
+    SentinelNode <T> &List<T>::sentinel() { return _sentinel; }
 
     template<typename T>
-    SentinelNode <T> &List<T>::tail() { return _tail; }
+    Node <T> &List<T>::first() { return _sentinel.next(); }
 
     template<typename T>
-    Node <T> &List<T>::first() { return this->head().next(); }
+    Node <T> &List<T>::last() { return _sentinel.prev(); }
 
     template<typename T>
-    Node <T> &List<T>::last() { return this->tail().prev(); }
+    typename List<T>::iterator List<T>::begin() { return iterator(_sentinel.next_link()); }
 
     template<typename T>
-    void List<T>::apply(void (*lambda)(Node <T> &node)) {
-        if (this->empty()) {
-            return;
+    typename List<T>::const_iterator List<T>::begin() const { return const_iterator(_sentinel.next_link()); }
+
+    template<typename T>
+    typename List<T>::const_iterator List<T>::cbegin() const { return begin(); }
+
+    template<typename T>
+    typename List<T>::iterator List<T>::end() { return iterator(&_sentinel); }
+
+    template<typename T>
+    typename List<T>::const_iterator List<T>::end() const { return const_iterator(&_sentinel); }
+
+    template<typename T>
+    typename List<T>::const_iterator List<T>::cend() const { return end(); }
+
+    template<typename T>
+    typename List<T>::reverse_iterator List<T>::rbegin() { return reverse_iterator(end()); }
+
+    template<typename T>
+    typename List<T>::const_reverse_iterator List<T>::rbegin() const { return const_reverse_iterator(end()); }
+
+    template<typename T>
+    typename List<T>::reverse_iterator List<T>::rend() { return reverse_iterator(begin()); }
+
+    template<typename T>
+    typename List<T>::const_reverse_iterator List<T>::rend() const { return const_reverse_iterator(begin()); }
+
+    template<typename T>
+    template<typename Function>
+    void List<T>::apply(Function &&function) {
+        NodeBase<T> *link = _sentinel.next_link();
+
+        while (link != &_sentinel) {
+            auto &node = static_cast<Node<T> &>(*link);
+            link = link->next_link();
+            function(node);
+        }
+    }
+
+    template<typename T>
+    template<typename Function>
+    Node <T> *List<T>::for_each_until(Function &&function) {
+        for (NodeBase<T> *link = _sentinel.next_link(); link != &_sentinel; link = link->next_link()) {
+            auto &node = static_cast<Node<T> &>(*link);
+
+            if (function(node)) {
+                return &node;
+            }
+        }
+
+        return nullptr;
+    }
+
+    template<typename T>
+    template<typename Predicate>
+    Node <T> *List<T>::find_if(Predicate &&pred) {
+        return for_each_until([&pred](const Node<T> &node) {
+            return static_cast<bool>(pred(node.value()));
+        });
+    }
+
+    template<typename T>
+    template<typename Predicate>
+    bool List<T>::any_of(Predicate &&pred) {
+        return find_if(std::forward<Predicate>(pred)) != nullptr;
+    }
+
+    template<typename T>
+    template<typename Acc, typename BinaryOp>
+    Acc List<T>::fold(Acc init, BinaryOp &&op) {
+        for (NodeBase<T> *link = _sentinel.next_link(); link != &_sentinel; link = link->next_link()) {
+            init = op(std::move(init), static_cast<const Node<T> &>(*link).value());
         }
 
-        apply_aux(first(), lambda);
+        return init;
     }
 
     template<typename T>
-    void List<T>::apply_aux(Node <T> &node, void (*lambda)(Node <T> &node)) {
-        if (!node.has_next()) {
-            lambda(node);
+    template<size_t Distance, typename Function>
+    void List<T>::apply_prefetched(Function &&function) {
+        if (!jumps_valid()) {
+            const uint64_t version = _version;
+
+            _jumps.clear();
+            _jumps.reserve(static_cast<size_t>(_size));
+            apply([this, &function](Node<T> &node) {
+                _jumps.push_back(&node);
+                function(node);
+            });
+
+            // If function unlinked a node, _version moved on and the table is
+            // rebuilt by the next call.
+            _jumps_version = version;
             return;
         }
 
-        auto &next = node.next();
-        lambda(node);
+        const size_t size = _jumps.size();
+        const size_t ahead = size > Distance ? size - Distance : 0;
+        size_t i = 0;
+
+        for (; i < ahead; i++) {
+            prefetch(_jumps[i + Distance]);
+            function(*_jumps[i]);
+        }
+
+        for (; i < size; i++) {
+            function(*_jumps[i]);
+        }
+    }
+
+    template<typename T>
+    template<typename UnaryOp>
+    void List<T>::transform_values(UnaryOp &&op) {
+        static_assert(is_block_value<T>::value, "transform_values needs arithmetic values, use apply");
+
+        for_each_block([&op](T *block, size_t size) {
+            BlockKernels<T>::transform(block, size, op);
+        }, true);
+    }
+
+    template<typename T>
+    T List<T>::sum() {
+        static_assert(is_block_value<T>::value, "sum needs arithmetic values, use fold");
+        T result = T();
+
+        for_each_block([&result](const T *block, size_t size) {
+            result += BlockKernels<T>::sum(block, size);
+        }, false);
+
+        return result;
+    }
+
+    template<typename T>
+    T List<T>::min() {
+        static_assert(is_block_value<T>::value, "min needs arithmetic values, use fold");
+
+        if (empty()) {
+            std::cerr << "Error: list is empty\n";
+            return T();
+        }
+
+        T result = first().value();
+
+        for_each_block([&result](const T *block, size_t size) {
+            const T lo = BlockKernels<T>::min(block, size);
+            result = lo < result ? lo : result;
+        }, false);
+
+        return result;
+    }
+
+    template<typename T>
+    T List<T>::max() {
+        static_assert(is_block_value<T>::value, "max needs arithmetic values, use fold");
+
+        if (empty()) {
+            std::cerr << "Error: list is empty\n";
+            return T();
+        }
+
+        T result = first().value();
+
+        for_each_block([&result](const T *block, size_t size) {
+            const T hi = BlockKernels<T>::max(block, size);
+            result = result < hi ? hi : result;
+        }, false);
+
+        return result;
+    }
+
+    template<typename T>
+    template<typename Predicate>
+    size_t List<T>::count_if(Predicate &&pred) {
+        static_assert(is_block_value<T>::value, "count_if needs arithmetic values, use fold");
+        size_t count = 0;
+
+        for_each_block([&pred, &count](const T *block, size_t size) {
+            count += BlockKernels<T>::count_if(block, size, pred);
+        }, false);
+
+        return count;
+    }
+
+    template<typename T>
+    T *List<T>::copy_values_to(T *out) const {
+        for (const NodeBase<T> *link = _sentinel.next_link(); link != &_sentinel; link = link->next_link()) {
+            *out++ = static_cast<const Node<T> &>(*link).value();
+        }
+
+        return out;
+    }
+
+    template<typename T>
+    std::vector<T> List<T>::to_vector() const {
+        std::vector<T> values;
+        values.reserve(static_cast<size_t>(_size));
+
+        for (const NodeBase<T> *link = _sentinel.next_link(); link != &_sentinel; link = link->next_link()) {
+            values.push_back(static_cast<const Node<T> &>(*link).value());
+        }
+
+        return values;
+    }
+
+    template<typename T>
+    ValueView<T, T> List<T>::values_view() {
+        if (empty() || !contiguous()) {
+            return ValueView<T, T>(nullptr, 0, end());
+        }
+
+        return ValueView<T, T>(&first(), static_cast<size_t>(_size), end());
+    }
+
+    template<typename T>
+    ValueView<T, const T> List<T>::values_view() const {
+        if (empty() || !contiguous()) {
+            return ValueView<T, const T>(nullptr, 0, end());
+        }
+
+        return ValueView<T, const T>(&static_cast<const Node<T> &>(*_sentinel.next_link()),
+                                     static_cast<size_t>(_size), end());
+    }
+
+    template<typename T>
+    void List<T>::reserve(size_t count) {
+        if (!_pool) {
+            _pool = std::make_shared<NodePool<T>>();
+        }
+
+        _pool->reserve(count);
+    }
+
+    template<typename T>
+    MemoryResource *List<T>::resource() const {
+        return _pool ? _pool->resource() : new_delete_resource();
+    }
 
-        apply_aux(next, lambda);
+    template<typename T>
+    bool List<T>::save(const std::string &path) const {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+
+        if (!out || !ListFile<T>::write_header(out, static_cast<uint64_t>(_size))) {
+            std::cerr << "Error: cannot write " << path << "\n";
+            return false;
+        }
+
+        // The values are written in blocks, not one by one.
+        std::vector<T> buffer;
+        buffer.reserve(std::min<size_t>(static_cast<size_t>(_size), 4096));
+
+        const auto flush = [&out, &buffer] {
+            out.write(reinterpret_cast<const char *>(buffer.data()),
+                      static_cast<std::streamsize>(buffer.size() * sizeof(T)));
+            buffer.clear();
+        };
+
+        for (const NodeBase<T> *link = _sentinel.next_link(); link != &_sentinel; link = link->next_link()) {
+            buffer.push_back(static_cast<const Node<T> &>(*link).value());
+
+            if (buffer.size() == buffer.capacity()) {
+                flush();
+            }
+        }
+
+        flush();
+        out.close();
+
+        if (!out) {
+            std::cerr << "Error: cannot write " << path << "\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    void List<T>::log_to(AbstractMutationLog<T> *log) {
+        _log = log;
+    }
+
+    template<typename T>
+    template<typename Pool, typename Function>
+    void List<T>::parallel_apply(Pool &pool, Function &&function) {
+        auto segments = submit_segments(pool, [&function](Node<T> &first, size_t length) {
+            NodeBase<T> *link = &first;
+
+            for (size_t i = 0; i < length; i++) {
+                auto &node = static_cast<Node<T> &>(*link);
+                link = link->next_link();
+                function(node);
+            }
+        });
+
+        // Every segment must end before an exception leaves, they use function.
+        for (auto &segment : segments) {
+            segment.wait();
+        }
+
+        for (auto &segment : segments) {
+            segment.get();
+        }
+    }
+
+    template<typename T>
+    template<typename Pool, typename BinaryOp>
+    T List<T>::parallel_reduce(Pool &pool, T init, BinaryOp &&op) {
+        auto segments = submit_segments(pool, [&op](Node<T> &first, size_t length) {
+            T acc = first.value();
+            NodeBase<T> *link = first.next_link();
+
+            for (size_t i = 1; i < length; i++) {
+                acc = op(acc, static_cast<const Node<T> &>(*link).value());
+                link = link->next_link();
+            }
+
+            return acc;
+        });
+
+        for (auto &segment : segments) {
+            segment.wait();
+        }
+
+        for (auto &segment : segments) {
+            init = op(init, segment.get());
+        }
+
+        return init;
+    }
+
+    template<typename T>
+    template<bool Ordered>
+    bool List<T>::load_from(const std::string &path) {
+        std::ifstream in(path, std::ios::binary);
+        uint64_t count = 0;
+        bool swap = false;
+
+        if (!in) {
+            std::cerr << "Error: cannot open " << path << "\n";
+            return false;
+        }
+
+        if (!ListFile<T>::read_header(in, count, swap)) {
+            return false;
+        }
+
+        if (count > static_cast<uint64_t>(std::numeric_limits<int32_t>::max() - _size)) {
+            std::cerr << "Error: too many values in " << path << "\n";
+            return false;
+        }
+
+        // The count of the header is checked against the file before the nodes
+        // are reserved, so that a damaged header can't ask for all the memory.
+        const std::streamoff values_begin = in.tellg();
+        in.seekg(0, std::ios::end);
+        const std::streamoff values_end = in.tellg();
+        in.seekg(values_begin);
+
+        if (!in || values_end < values_begin ||
+            count > static_cast<uint64_t>(values_end - values_begin) / sizeof(T)) {
+            std::cerr << "Error: " << path << " is truncated\n";
+            return false;
+        }
+
+        reserve(static_cast<size_t>(count));
+
+        std::vector<T> buffer(static_cast<size_t>(std::min<uint64_t>(count, 4096)));
+        Node<T> *first = nullptr;
+        Node<T> *last = nullptr;
+        uint64_t loaded = 0;
+        bool sorted = true;
+
+        while (sorted && loaded < count) {
+            const auto block = static_cast<size_t>(std::min<uint64_t>(buffer.size(), count - loaded));
+
+            if (!in.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(block * sizeof(T)))) {
+                std::cerr << "Error: " << path << " is truncated\n";
+                break;
+            }
+
+            for (size_t i = 0; i < block; i++) {
+                if (swap) {
+                    ListFile<T>::swap_bytes(buffer[i]);
+                }
+
+                Node<T> &node = create_node(buffer[i]);
+
+                // The stored order is trusted, it's only checked.
+                if (last == nullptr) {
+                    sorted = empty() || !out_of_order(this->last(), node, std::integral_constant<bool, Ordered>());
+                    first = &node;
+                } else {
+                    sorted = sorted && !out_of_order(*last, node, std::integral_constant<bool, Ordered>());
+                    last->next(node);
+                    node.prev(*last);
+                }
+
+                last = &node;
+            }
+
+            loaded += block;
+        }
+
+        if (!sorted || loaded < count) {
+            if (!sorted) {
+                std::cerr << "Error: the values of " << path << " are not in order\n";
+            }
+
+            for (Node<T> *node = first; node != nullptr;) {
+                Node<T> *next = node == last ? nullptr : &node->next();
+                node->clear_next();
+                node->clear_prev();
+                dispose(*node);
+                node = next;
+            }
+
+            return false;
+        }
+
+        if (first != nullptr) {
+            splice(_sentinel, *first, *last);
+            _size += static_cast<int32_t>(count);
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    bool List<T>::out_of_order(const Node <T> &prev, const Node <T> &node, std::true_type) {
+        return node < prev;
+    }
+
+    template<typename T>
+    bool List<T>::out_of_order(const Node <T> &, const Node <T> &, std::false_type) {
+        return false;
+    }
+
+    template<typename T>
+    template<typename Pool, typename Segment>
+    auto List<T>::submit_segments(Pool &pool, Segment segment) {
+        // A few segments per worker, so that a slow one doesn't stall the others.
+        const auto count = static_cast<size_t>(_size);
+        const size_t parts = std::min(count, pool.size() * 4);
+
+        const auto task = [segment](Node<T> &first, size_t length) {
+            return [segment, &first, length] {
+                return segment(first, length);
+            };
+        };
+
+        std::vector<decltype(pool.submit(task(std::declval<Node<T> &>(), size_t())))> segments;
+        segments.reserve(parts);
+
+        // The first nodes of the segments are kept until the links change, so
+        // the next calls don't walk the list before submitting.
+        const bool cached = _segments_version == _version && _segments.size() == parts;
+        if (!cached) {
+            _segments.clear();
+            _segments_version = _version;
+        }
+
+        NodeBase<T> *link = _sentinel.next_link();
+        for (size_t part = 0; part < parts; part++) {
+            const size_t length = count / parts + (part < count % parts ? 1 : 0);
+            auto &first = cached ? *_segments[part] : static_cast<Node<T> &>(*link);
+
+            segments.push_back(pool.submit(task(first, length)));
+
+            if (cached) {
+                continue;
+            }
+
+            _segments.push_back(&first);
+            for (size_t i = 0; i < length; i++) {
+                link = link->next_link();
+            }
+        }
+
+        return segments;
+    }
+
+    template<typename T>
+    void List<T>::splice(NodeBase <T> &pos, Node <T> &first, Node <T> &last) {
+        NodeBase<T> &prev = *pos.prev_link();
+        _version++;
+
+        prev.next(first);
+        first.prev(prev);
+        last.next(pos);
+        pos.prev(last);
+    }
+
+    template<typename T>
+    void List<T>::release(Node <T> *&first, Node <T> *&last) {
+        first = &this->first();
+        last = &this->last();
+
+        first->clear_prev();
+        last->clear_next();
+        _sentinel.reset();
+        _version++;
+    }
+
+    template<typename T>
+    template<typename Kernel>
+    void List<T>::for_each_block(Kernel &&kernel, bool write_back) {
+        alignas(32) T block[BlockKernels<T>::block_size];
+        Node<T> *nodes[BlockKernels<T>::block_size];
+        NodeBase<T> *link = _sentinel.next_link();
+        // With a valid table of jump pointers the loads of a block don't depend
+        // on each other, otherwise the gather is a walk.
+        const bool jumps = jumps_valid();
+        size_t next = 0;
+
+        while (jumps ? next < _jumps.size() : link != &_sentinel) {
+            size_t size = 0;
+
+            if (jumps) {
+                size = std::min(BlockKernels<T>::block_size, _jumps.size() - next);
+
+                for (size_t i = 0; i < size; i++) {
+                    nodes[i] = _jumps[next + i];
+                    block[i] = nodes[i]->value();
+                }
+
+                next += size;
+            } else {
+                for (; size < BlockKernels<T>::block_size && link != &_sentinel; size++) {
+                    nodes[size] = static_cast<Node<T> *>(link);
+                    block[size] = nodes[size]->value();
+                    link = link->next_link();
+                }
+            }
+
+            kernel(block, size);
+
+            if (write_back) {
+                for (size_t i = 0; i < size; i++) {
+                    nodes[i]->value(block[i]);
+                }
+            }
+        }
+    }
+
+    template<typename T>
+    bool List<T>::contiguous() const {
+        if (empty()) {
+            return true;
+        }
+
+        const auto *node = &static_cast<const Node<T> &>(*_sentinel.next_link());
+
+        for (int32_t i = 1; i < _size; i++) {
+            const auto *next = &static_cast<const Node<T> &>(*node->next_link());
+
+            if (next != node + 1) {
+                return false;
+            }
+
+            node = next;
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    bool List<T>::jumps_valid() const {
+        return !_jumps.empty() && _jumps_version == _version;
+    }
+
+    template<typename T>
+    void List<T>::prefetch(const void *address) {
+#if defined(__GNUC__)
+        __builtin_prefetch(address);
+#else
+        static_cast<void>(address);
+#endif
+    }
+
+    template<typename T>
+    template<typename... Args>
+    Node <T> &List<T>::create_node(Args &&... args) {
+        if (!_pool) {
+            _pool = std::make_shared<NodePool<T>>();
+        }
+
+        return *_pool->create(std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    void List<T>::dispose(Node <T> &node) {
+        if (_pool && _pool->owns(&node)) {
+            _pool->destroy(&node);
+        } else if (_allocated) {
+            delete &node;
+        }
+    }
+
+    template<typename T>
+    void List<T>::use_resource(MemoryResource *resource) {
+        _pool = std::make_shared<NodePool<T>>(64, resource);
     }
 
 } // namespace simple_list
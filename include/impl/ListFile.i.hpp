@@ -0,0 +1,133 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace simple_list {
+
+    template<typename T>
+    constexpr uint16_t ListFile<T>::version;
+
+    template<typename T>
+    bool ListFile<T>::write_header(std::ostream &out, uint64_t count) {
+        char header[24] = {'S', 'L', 'S', 'T'};
+        const uint16_t format = version;
+        const uint32_t order = 0x01020304;
+        const auto value_size = static_cast<uint32_t>(sizeof(T));
+
+        std::memcpy(header + 4, &format, sizeof(format));
+        header[6] = kind();
+        std::memcpy(header + 8, &order, sizeof(order));
+        std::memcpy(header + 12, &value_size, sizeof(value_size));
+        std::memcpy(header + 16, &count, sizeof(count));
+
+        return static_cast<bool>(out.write(header, sizeof(header)));
+    }
+
+    template<typename T>
+    bool ListFile<T>::read_header(std::istream &in, uint64_t &count, bool &swap) {
+        char header[24];
+
+        if (!in.read(header, sizeof(header)) || std::memcmp(header, "SLST", 4) != 0) {
+            std::cerr << "Error: not a list file\n";
+            return false;
+        }
+
+        uint16_t format;
+        uint32_t order;
+        uint32_t value_size;
+        std::memcpy(&format, header + 4, sizeof(format));
+        std::memcpy(&order, header + 8, sizeof(order));
+        std::memcpy(&value_size, header + 12, sizeof(value_size));
+        std::memcpy(&count, header + 16, sizeof(count));
+
+        swap = order != 0x01020304;
+
+        if (swap) {
+            format = swapped(format);
+            order = swapped(order);
+            value_size = swapped(value_size);
+            count = swapped(count);
+        }
+
+        if (order != 0x01020304 || format != version) {
+            std::cerr << "Error: unsupported list file\n";
+            return false;
+        }
+
+        if (header[6] != kind() || value_size != sizeof(T)) {
+            std::cerr << "Error: the values of the file are not of the type of the list\n";
+            return false;
+        }
+
+        if (swap && !std::is_arithmetic<T>::value) {
+            std::cerr << "Error: the values of the file are in the other byte order\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    void ListFile<T>::swap_bytes(T &value) {
+        unsigned char bytes[sizeof(T)];
+
+        std::memcpy(bytes, &value, sizeof(T));
+        std::reverse(bytes, bytes + sizeof(T));
+        std::memcpy(&value, bytes, sizeof(T));
+    }
+
+    template<typename T>
+    constexpr char ListFile<T>::kind() {
+        return std::is_floating_point<T>::value ? 'f'
+                                                : std::is_integral<T>::value ? (std::is_signed<T>::value ? 'i' : 'u')
+                                                                             : 'b';
+    }
+
+    template<typename T>
+    template<typename U>
+    U ListFile<T>::swapped(U value) {
+        U result = 0;
+
+        for (size_t i = 0; i < sizeof(U); i++) {
+            result = static_cast<U>((result << 8) | (value & 0xFF));
+            value = static_cast<U>(value >> 8);
+        }
+
+        return result;
+    }
+
+} // namespace simple_list
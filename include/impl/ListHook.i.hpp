@@ -0,0 +1,99 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+#pragma once
+
+#include <type_traits>
+
+namespace simple_list {
+
+    template<typename Tag, typename Check>
+    ListHook<Tag, Check>::ListHook(const ListHook &obj)
+            : RingLinks<ListHook<Tag, Check>>() {
+        static_cast<void>(obj);
+    }
+
+    template<typename Tag, typename Check>
+    ListHook <Tag, Check> &ListHook<Tag, Check>::operator=(const ListHook &obj) {
+        static_cast<void>(obj);
+
+        return *this;
+    }
+
+    template<typename Tag, typename Check>
+    ListHook<Tag, Check>::~ListHook() {
+        Check::check(!linked(), "hook destroyed while in a list");
+    }
+
+    template<typename Tag, typename Check>
+    bool ListHook<Tag, Check>::linked() const { return this->has_next(); }
+
+    template<typename T, typename Tag, typename Check>
+    typename BaseHook<T, Tag, Check>::hook_type &BaseHook<T, Tag, Check>::to_hook(T &value) {
+        return value;
+    }
+
+    template<typename T, typename Tag, typename Check>
+    const typename BaseHook<T, Tag, Check>::hook_type &BaseHook<T, Tag, Check>::to_hook(const T &value) {
+        return value;
+    }
+
+    template<typename T, typename Tag, typename Check>
+    T &BaseHook<T, Tag, Check>::to_value(hook_type &hook) {
+        return static_cast<T &>(hook);
+    }
+
+    template<typename T, typename Hook, Hook T::*Member>
+    Hook &MemberHook<T, Hook, Member>::to_hook(T &value) {
+        return value.*Member;
+    }
+
+    template<typename T, typename Hook, Hook T::*Member>
+    const Hook &MemberHook<T, Hook, Member>::to_hook(const T &value) {
+        return value.*Member;
+    }
+
+    template<typename T, typename Hook, Hook T::*Member>
+    T &MemberHook<T, Hook, Member>::to_value(Hook &hook) {
+        return *reinterpret_cast<T *>(reinterpret_cast<char *>(&hook) - offset());
+    }
+
+    template<typename T, typename Hook, Hook T::*Member>
+    std::ptrdiff_t MemberHook<T, Hook, Member>::offset() {
+        // Measured on raw storage, so T doesn't need to be constructible. The
+        // compiler folds it to a constant.
+        const typename std::aligned_storage<sizeof(T), alignof(T)>::type storage{};
+        const auto *object = reinterpret_cast<const T *>(&storage);
+
+        return reinterpret_cast<const char *>(&(object->*Member)) - reinterpret_cast<const char *>(object);
+    }
+
+} // namespace simple_list
@@ -0,0 +1,107 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+#pragma once
+
+namespace simple_list {
+
+    template<typename T, typename V>
+    ListIterator<T, V>::ListIterator(Link *link)
+            : _link(link) {
+    }
+
+    template<typename T, typename V>
+    template<typename U, typename>
+    ListIterator<T, V>::ListIterator(const ListIterator<T, U> &obj)
+            : _link(obj.link()) {
+    }
+
+    template<typename T, typename V>
+    typename ListIterator<T, V>::reference ListIterator<T, V>::operator*() const {
+        return node().value();
+    }
+
+    template<typename T, typename V>
+    typename ListIterator<T, V>::pointer ListIterator<T, V>::operator->() const {
+        return &node().value();
+    }
+
+    template<typename T, typename V>
+    ListIterator <T, V> &ListIterator<T, V>::operator++() {
+        _link = _link->next_link();
+
+        return *this;
+    }
+
+    template<typename T, typename V>
+    ListIterator <T, V> ListIterator<T, V>::operator++(int) {
+        ListIterator old = *this;
+        _link = _link->next_link();
+
+        return old;
+    }
+
+    template<typename T, typename V>
+    ListIterator <T, V> &ListIterator<T, V>::operator--() {
+        _link = _link->prev_link();
+
+        return *this;
+    }
+
+    template<typename T, typename V>
+    ListIterator <T, V> ListIterator<T, V>::operator--(int) {
+        ListIterator old = *this;
+        _link = _link->prev_link();
+
+        return old;
+    }
+
+    template<typename T, typename V>
+    bool ListIterator<T, V>::operator==(const ListIterator &b) const {
+        return _link == b._link;
+    }
+
+    template<typename T, typename V>
+    bool ListIterator<T, V>::operator!=(const ListIterator &b) const {
+        return _link != b._link;
+    }
+
+    template<typename T, typename V>
+    typename ListIterator<T, V>::NodeType &ListIterator<T, V>::node() const {
+        return static_cast<NodeType &>(*_link);
+    }
+
+    template<typename T, typename V>
+    typename ListIterator<T, V>::Link *ListIterator<T, V>::link() const {
+        return _link;
+    }
+
+} // namespace simple_list
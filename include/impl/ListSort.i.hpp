@@ -0,0 +1,335 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <cstring>
+
+namespace simple_list {
+
+    template<typename T>
+    template<typename Compare>
+    void ListSort<T>::merge_sort(Node <T> *&first, Node <T> *&last, Compare comp) {
+        if (first == last) {
+            first->clear_prev();
+            first->clear_next();
+            return;
+        }
+
+        // bins[i] is either empty or holds a sorted run of 2^i nodes that
+        // precede every node of the runs in bins[0..i-1]. merge keeps the
+        // previous links, so only the last node of each run is tracked: on equal
+        // values the right run goes last.
+        Node<T> *bins[kBins] = {};
+        Node<T> *tails[kBins] = {};
+        int fill = 0;
+
+        last->clear_next();
+        Node<T> *cur = first;
+
+        while (cur != nullptr) {
+            Node<T> *run = cur;
+            Node<T> *tail = cur;
+            cur = next_of(cur);
+            run->clear_next();
+
+            int i = 0;
+            for (; i < fill && bins[i] != nullptr; i++) {
+                tail = comp(tail->value(), tails[i]->value()) ? tails[i] : tail;
+                run = merge(bins[i], run, comp);
+                bins[i] = nullptr;
+            }
+
+            bins[i] = run;
+            tails[i] = tail;
+            if (i == fill) {
+                fill++;
+            }
+        }
+
+        first = nullptr;
+        for (int i = 0; i < fill; i++) {
+            if (bins[i] == nullptr) {
+                continue;
+            }
+
+            if (first == nullptr) {
+                first = bins[i];
+                last = tails[i];
+            } else {
+                last = comp(last->value(), tails[i]->value()) ? tails[i] : last;
+                first = merge(bins[i], first, comp);
+            }
+        }
+    }
+
+    template<typename T>
+    void ListSort<T>::radix_sort(Node <T> *&first, Node <T> *&last) {
+        using Key = typename RadixKey<T>::type;
+        constexpr int kPasses = sizeof(Key);
+
+        last->clear_next();
+
+        // One pre-pass builds the histograms of every byte, so the passes
+        // where all the nodes would end up in the same bucket can be skipped.
+        size_t counts[kPasses][kBuckets] = {};
+        size_t count = 0;
+
+        for (Node<T> *cur = first; cur != nullptr; cur = next_of(cur)) {
+            const Key key = RadixKey<T>::key(cur->value());
+
+            for (int pass = 0; pass < kPasses; pass++) {
+                counts[pass][(key >> (8 * pass)) & 0xFFU]++;
+            }
+
+            count++;
+        }
+
+        for (int pass = 0; pass < kPasses; pass++) {
+            const Key byte = (RadixKey<T>::key(first->value()) >> (8 * pass)) & 0xFFU;
+            if (counts[pass][byte] == count) {
+                continue;
+            }
+
+            Node<T> *heads[kBuckets] = {};
+            Node<T> *tails[kBuckets] = {};
+
+            Node<T> *cur = first;
+            while (cur != nullptr) {
+                Node<T> *next = next_of(cur);
+                const size_t bucket = (RadixKey<T>::key(cur->value()) >> (8 * pass)) & 0xFFU;
+
+                if (tails[bucket] == nullptr) {
+                    heads[bucket] = cur;
+                } else {
+                    tails[bucket]->next(*cur);
+                }
+
+                tails[bucket] = cur;
+                cur = next;
+            }
+
+            Node<T> *end = nullptr;
+            for (int bucket = 0; bucket < kBuckets; bucket++) {
+                if (heads[bucket] == nullptr) {
+                    continue;
+                }
+
+                if (end == nullptr) {
+                    first = heads[bucket];
+                } else {
+                    end->next(*heads[bucket]);
+                }
+
+                end = tails[bucket];
+            }
+
+            end->clear_next();
+        }
+
+        last = relink_prev(first);
+    }
+
+    template<typename T>
+    typename RadixKey<T, typename std::enable_if<std::is_integral<T>::value>::type>::type
+    RadixKey<T, typename std::enable_if<std::is_integral<T>::value>::type>::key(T value) {
+        type key;
+        std::memcpy(&key, &value, sizeof(key));
+
+        if (std::is_signed<T>::value) {
+            key ^= static_cast<type>(type(1) << (8 * sizeof(type) - 1));
+        }
+
+        return key;
+    }
+
+    template<typename T>
+    typename RadixKey<T, typename std::enable_if<std::is_floating_point<T>::value>::type>::type
+    RadixKey<T, typename std::enable_if<std::is_floating_point<T>::value>::type>::key(T value) {
+        type key;
+        std::memcpy(&key, &value, sizeof(key));
+
+        const auto sign = static_cast<type>(type(1) << (8 * sizeof(type) - 1));
+
+        if ((key & sign) != 0) {
+            return static_cast<type>(~key);
+        }
+
+        return static_cast<type>(key | sign);
+    }
+
+    template<typename T, typename Enable>
+    void DefaultSort<T, Enable>::sort(Node <T> *&first, Node <T> *&last) {
+        ListSort<T>::merge_sort(first, last, std::less<T>());
+    }
+
+    template<typename T>
+    void DefaultSort<T, typename std::enable_if<std::is_integral<T>::value && sizeof(T) <= 8>::type>::sort(
+            Node <T> *&first, Node <T> *&last) {
+        ListSort<T>::radix_sort(first, last);
+    }
+
+    template<typename T>
+    void DefaultSort<T, typename std::enable_if<std::is_floating_point<T>::value && sizeof(T) <= 8>::type>::sort(
+            Node <T> *&first, Node <T> *&last) {
+        ListSort<T>::radix_sort(first, last);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    Node <T> *ListSort<T>::merge(Node <T> *left, Node <T> *right, Compare comp) {
+        if (left == nullptr) {
+            return right;
+        }
+
+        if (right == nullptr) {
+            return left;
+        }
+
+        Node<T> *head;
+        if (comp(right->value(), left->value())) {
+            head = right;
+            right = next_of(right);
+        } else {
+            head = left;
+            left = next_of(left);
+        }
+
+        head->clear_prev();
+
+        Node<T> *tail = head;
+        while (left != nullptr && right != nullptr) {
+            Node<T> *&from = comp(right->value(), left->value()) ? right : left;
+            Node<T> *node = from;
+            from = next_of(from);
+
+            tail->next(*node);
+            node->prev(*tail);
+            tail = node;
+        }
+
+        Node<T> *rest = left != nullptr ? left : right;
+        tail->next(*rest);
+        rest->prev(*tail);
+
+        return head;
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void ListSort<T>::parallel_merge(ThreadPool &pool, std::vector<Node<T> *> &firsts,
+                                     std::vector<Node<T> *> &lasts, Compare comp) {
+        while (firsts.size() > 1) {
+            const size_t pairs = firsts.size() / 2;
+            std::vector<std::future<void>> merges;
+            merges.reserve(pairs);
+
+            for (size_t i = 0; i < pairs; i++) {
+                merges.push_back(pool.submit([&firsts, &lasts, comp, i] {
+                    Node<T> *&first = firsts[2 * i];
+                    Node<T> *&last = lasts[2 * i];
+                    Node<T> *right_last = lasts[2 * i + 1];
+
+                    // On equal values the right chain goes last.
+                    last = comp(right_last->value(), last->value()) ? last : right_last;
+                    first = merge(first, firsts[2 * i + 1], comp);
+                }));
+            }
+
+            for (auto &merge : merges) {
+                merge.get();
+            }
+
+            for (size_t i = 0; i < pairs; i++) {
+                firsts[i] = firsts[2 * i];
+                lasts[i] = lasts[2 * i];
+            }
+
+            if (firsts.size() % 2 != 0) {
+                firsts[pairs] = firsts.back();
+                lasts[pairs] = lasts.back();
+                firsts.resize(pairs + 1);
+                lasts.resize(pairs + 1);
+            } else {
+                firsts.resize(pairs);
+                lasts.resize(pairs);
+            }
+        }
+    }
+
+    template<typename T>
+    void ListSort<T>::split(Node <T> *first, size_t count, size_t parts,
+                            std::vector<Node<T> *> &firsts, std::vector<Node<T> *> &lasts) {
+        firsts.clear();
+        lasts.clear();
+
+        Node<T> *cur = first;
+        for (size_t part = 0; part < parts; part++) {
+            const size_t length = count / parts + (part < count % parts ? 1 : 0);
+
+            firsts.push_back(cur);
+            for (size_t i = 1; i < length; i++) {
+                cur = next_of(cur);
+            }
+
+            lasts.push_back(cur);
+            cur = next_of(cur);
+            lasts.back()->clear_next();
+
+            if (cur != nullptr) {
+                cur->clear_prev();
+            }
+        }
+    }
+
+    template<typename T>
+    Node <T> *ListSort<T>::relink_prev(Node <T> *first) {
+        first->clear_prev();
+
+        Node<T> *cur = first;
+        Node<T> *next = next_of(cur);
+
+        while (next != nullptr) {
+            next->prev(*cur);
+            cur = next;
+            next = next_of(cur);
+        }
+
+        return cur;
+    }
+
+    template<typename T>
+    Node <T> *ListSort<T>::next_of(Node <T> *node) {
+        return node->has_next() ? &node->next() : nullptr;
+    }
+
+} // namespace simple_list
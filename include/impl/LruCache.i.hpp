@@ -0,0 +1,100 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+namespace simple_list {
+
+    template<typename K, typename V, typename Hash>
+    LruCache<K, V, Hash>::LruCache(size_t capacity)
+            : _capacity(capacity == 0 ? 1 : capacity) {
+        _map.reserve(_capacity);
+    }
+
+    template<typename K, typename V, typename Hash>
+    bool LruCache<K, V, Hash>::get(const K &key, V &value) {
+        auto it = _map.find(key);
+
+        if (it == _map.end()) {
+            _misses++;
+            return false;
+        }
+
+        _hits++;
+        _list.move_to_front(*it->second);
+        value = it->second->value().value;
+
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash>
+    void LruCache<K, V, Hash>::put(const K &key, const V &value) {
+        auto it = _map.find(key);
+
+        if (it != _map.end()) {
+            it->second->value().value = value;
+            _list.move_to_front(*it->second);
+            return;
+        }
+
+        if (_map.size() < _capacity) {
+            _map.emplace(key, &_list.emplace_front(Entry{key, value}));
+            return;
+        }
+
+        // The evicted node is reused for the new entry.
+        Node<Entry> &node = _list.remove_back();
+        _map.erase(node.value().key);
+        node.value().key = key;
+        node.value().value = value;
+        _evictions++;
+
+        _list.add_front(node);
+        _map.emplace(key, &node);
+    }
+
+    template<typename K, typename V, typename Hash>
+    size_t LruCache<K, V, Hash>::size() const { return _map.size(); }
+
+    template<typename K, typename V, typename Hash>
+    size_t LruCache<K, V, Hash>::capacity() const { return _capacity; }
+
+    template<typename K, typename V, typename Hash>
+    uint64_t LruCache<K, V, Hash>::hits() const { return _hits; }
+
+    template<typename K, typename V, typename Hash>
+    uint64_t LruCache<K, V, Hash>::misses() const { return _misses; }
+
+    template<typename K, typename V, typename Hash>
+    uint64_t LruCache<K, V, Hash>::evictions() const { return _evictions; }
+
+} // namespace simple_list
@@ -0,0 +1,171 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace simple_list {
+
+    template<typename T>
+    MappedList <T> *MappedList<T>::open(const std::string &path, uint64_t capacity) {
+        struct stat status{};
+
+        // An empty file is also replaced: it can't hold a list.
+        const bool missing = stat(path.c_str(), &status) != 0 ? errno == ENOENT : status.st_size == 0;
+
+        if (missing && !create(path, capacity == 0 ? 1 : capacity)) {
+            return nullptr;
+        }
+
+        const int fd = ::open(path.c_str(), O_RDWR);
+
+        if (fd < 0) {
+            std::cerr << "Error: cannot open " << path << "\n";
+            return nullptr;
+        }
+
+        auto *list = new MappedList<T>(fd);
+
+        if (fstat(fd, &status) != 0) {
+            std::cerr << "Error: cannot open " << path << "\n";
+            delete list;
+            return nullptr;
+        }
+
+        const auto size = static_cast<size_t>(status.st_size);
+
+        if (!list->map(size) || !OffsetList<T>::valid(list->_mapping, size)) {
+            delete list;
+            return nullptr;
+        }
+
+        return list;
+    }
+
+    template<typename T>
+    MappedList<T>::~MappedList() {
+        if (_mapping != nullptr) {
+            munmap(_mapping, _bytes);
+        }
+
+        close(_fd);
+    }
+
+    template<typename T>
+    bool MappedList<T>::sync() {
+        if (msync(_mapping, _bytes, MS_SYNC) != 0) {
+            std::cerr << "Error: cannot sync the mapped list\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    bool MappedList<T>::grow() {
+        const uint64_t capacity = this->header().capacity * 2;
+        const size_t size = OffsetList<T>::bytes(capacity);
+
+        if (ftruncate(_fd, static_cast<off_t>(size)) != 0 || !map(size)) {
+            return false;
+        }
+
+        // The offsets don't depend on where the file is mapped, only the
+        // capacity changes.
+        this->header().capacity = capacity;
+
+        return true;
+    }
+
+    template<typename T>
+    bool MappedList<T>::create(const std::string &path, uint64_t capacity) {
+        const std::string temporary = path + ".tmp";
+        const int fd = ::open(temporary.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+        if (fd < 0) {
+            std::cerr << "Error: cannot create " << path << "\n";
+            return false;
+        }
+
+        // ftruncate zeroes the slots and the sentinel, that is an empty ring, so
+        // only the header is written.
+        typename OffsetList<T>::Header header{};
+        OffsetList<T>::format(&header, capacity);
+
+        const bool written = ftruncate(fd, static_cast<off_t>(OffsetList<T>::bytes(capacity))) == 0 &&
+                             pwrite(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+                             fsync(fd) == 0;
+        close(fd);
+
+        // The file appears under path only once it holds a list.
+        if (!written || std::rename(temporary.c_str(), path.c_str()) != 0) {
+            std::cerr << "Error: cannot create " << path << "\n";
+            unlink(temporary.c_str());
+            return false;
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    MappedList<T>::MappedList(int fd)
+            : _fd(fd) {
+    }
+
+    template<typename T>
+    bool MappedList<T>::map(size_t size) {
+        void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+
+        if (mapping == MAP_FAILED) {
+            std::cerr << "Error: cannot map the list\n";
+            return false;
+        }
+
+        if (_mapping != nullptr) {
+            munmap(_mapping, _bytes);
+        }
+
+        _mapping = mapping;
+        _bytes = size;
+        this->attach(mapping);
+
+        return true;
+    }
+
+} // namespace simple_list
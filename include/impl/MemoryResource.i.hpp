@@ -0,0 +1,172 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace simple_list {
+
+    inline void *MemoryResource::allocate(size_t bytes, size_t alignment) {
+        return do_allocate(bytes, alignment);
+    }
+
+    inline void MemoryResource::deallocate(void *pointer, size_t bytes, size_t alignment) {
+        do_deallocate(pointer, bytes, alignment);
+    }
+
+    inline bool MemoryResource::is_equal(const MemoryResource &other) const {
+        return this == &other || do_is_equal(other);
+    }
+
+    inline bool MemoryResource::do_is_equal(const MemoryResource &other) const {
+        return this == &other;
+    }
+
+/**
+ * @brief The resource of new_delete_resource. The memory is aligned as by the
+ * global operator new, that is to std::max_align_t.
+ */
+    class NewDeleteResource final : public MemoryResource {
+    private:
+        void *do_allocate(size_t bytes, size_t) override {
+            return ::operator new(bytes);
+        }
+
+        void do_deallocate(void *pointer, size_t, size_t) override {
+            ::operator delete(pointer);
+        }
+
+        bool do_is_equal(const MemoryResource &other) const override {
+            return dynamic_cast<const NewDeleteResource *>(&other) != nullptr;
+        }
+    };
+
+    inline MemoryResource *new_delete_resource() {
+        static NewDeleteResource resource;
+
+        return &resource;
+    }
+
+    inline MonotonicBuffer::MonotonicBuffer(size_t size, MemoryResource *upstream)
+            : _upstream(upstream), _buffer(nullptr), _buffer_size(0), _current(nullptr), _left(0),
+              _next_size(size == 0 ? 1 : size) {
+    }
+
+    inline MonotonicBuffer::MonotonicBuffer(void *buffer, size_t size, MemoryResource *upstream)
+            : _upstream(upstream), _buffer(buffer), _buffer_size(size), _current(static_cast<char *>(buffer)),
+              _left(size), _next_size(size == 0 ? 4096 : size * 2) {
+    }
+
+    inline MonotonicBuffer::~MonotonicBuffer() {
+        release();
+    }
+
+    inline void MonotonicBuffer::release() {
+        for (const auto &block : _blocks) {
+            _upstream->deallocate(block.memory, block.size);
+        }
+
+        _blocks.clear();
+        _current = static_cast<char *>(_buffer);
+        _left = _buffer_size;
+    }
+
+    inline size_t MonotonicBuffer::upstream_bytes() const {
+        size_t bytes = 0;
+
+        for (const auto &block : _blocks) {
+            bytes += block.size;
+        }
+
+        return bytes;
+    }
+
+    inline void *MonotonicBuffer::do_allocate(size_t bytes, size_t alignment) {
+        size_t padding = (alignment - reinterpret_cast<uintptr_t>(_current) % alignment) % alignment;
+
+        if (_current == nullptr || padding + bytes > _left) {
+            // The blocks double, so a list that keeps growing takes a
+            // logarithmic number of them.
+            const size_t size = std::max(_next_size, bytes + alignment);
+
+            _blocks.push_back(Block{_upstream->allocate(size), size});
+            _current = static_cast<char *>(_blocks.back().memory);
+            _left = size;
+            _next_size = size * 2;
+            padding = (alignment - reinterpret_cast<uintptr_t>(_current) % alignment) % alignment;
+        }
+
+        char *memory = _current + padding;
+        _current = memory + bytes;
+        _left -= padding + bytes;
+
+        return memory;
+    }
+
+    inline void MonotonicBuffer::do_deallocate(void *, size_t, size_t) {
+    }
+
+    template<typename Allocator>
+    AllocatorResource<Allocator>::AllocatorResource(const Allocator &allocator)
+            : _allocator(allocator) {
+    }
+
+    template<typename Allocator>
+    size_t AllocatorResource<Allocator>::units(size_t bytes) {
+        return (bytes + sizeof(Unit) - 1) / sizeof(Unit);
+    }
+
+    template<typename Allocator>
+    void *AllocatorResource<Allocator>::do_allocate(size_t bytes, size_t alignment) {
+        if (alignment > alignof(Unit)) {
+            throw std::bad_alloc();
+        }
+
+        return Traits::allocate(_allocator, units(bytes));
+    }
+
+    template<typename Allocator>
+    void AllocatorResource<Allocator>::do_deallocate(void *pointer, size_t bytes, size_t) {
+        Traits::deallocate(_allocator, static_cast<Unit *>(pointer), units(bytes));
+    }
+
+    template<typename Allocator>
+    bool AllocatorResource<Allocator>::do_is_equal(const MemoryResource &other) const {
+        const auto *resource = dynamic_cast<const AllocatorResource<Allocator> *>(&other);
+
+        return resource != nullptr && resource->_allocator == _allocator;
+    }
+
+} // namespace simple_list
@@ -0,0 +1,341 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace simple_list {
+
+    template<typename T>
+    constexpr uint16_t MutationLog<T>::version;
+
+    template<typename T>
+    constexpr size_t MutationLog<T>::header_size;
+
+    template<typename T>
+    constexpr size_t MutationLog<T>::group_header_size;
+
+    template<typename T>
+    MutationLog <T> *MutationLog<T>::open(const std::string &path, size_t group) {
+        const int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        struct stat status{};
+
+        if (fd < 0 || fstat(fd, &status) != 0) {
+            std::cerr << "Error: cannot open " << path << "\n";
+
+            if (fd >= 0) {
+                close(fd);
+            }
+
+            return nullptr;
+        }
+
+        const auto size = static_cast<size_t>(status.st_size);
+        size_t end = header_size;
+
+        if (size == 0) {
+            char header[header_size] = {'S', 'L', 'W', 'L'};
+            const uint16_t format = version;
+            const uint32_t order = 0x01020304;
+            const auto value_size = static_cast<uint32_t>(sizeof(T));
+
+            std::memcpy(header + 4, &format, sizeof(format));
+            header[6] = ListFile<T>::kind();
+            std::memcpy(header + 8, &order, sizeof(order));
+            std::memcpy(header + 12, &value_size, sizeof(value_size));
+
+            if (write(fd, header, header_size) != static_cast<ssize_t>(header_size) || fdatasync(fd) != 0) {
+                std::cerr << "Error: cannot create " << path << "\n";
+                close(fd);
+                return nullptr;
+            }
+        } else {
+            void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            const bool valid = data != MAP_FAILED &&
+                               decode(static_cast<const char *>(data), size, [](LogOp, const T &, int32_t) {
+                                   return true;
+                               }, end);
+
+            if (data != MAP_FAILED) {
+                munmap(data, size);
+            }
+
+            // The groups after end were torn by a crash, the next ones must
+            // follow the last committed group to be read back.
+            if (!valid || (end < size && ftruncate(fd, static_cast<off_t>(end)) != 0)) {
+                std::cerr << "Error: cannot open " << path << "\n";
+                close(fd);
+                return nullptr;
+            }
+        }
+
+        lseek(fd, static_cast<off_t>(end), SEEK_SET);
+
+        return new MutationLog<T>(fd, end, group == 0 ? 1 : group);
+    }
+
+    template<typename T>
+    template<typename Visitor>
+    bool MutationLog<T>::read(const std::string &path, Visitor &&visitor) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        struct stat status{};
+
+        if (fd < 0 || fstat(fd, &status) != 0) {
+            std::cerr << "Error: cannot open " << path << "\n";
+
+            if (fd >= 0) {
+                close(fd);
+            }
+
+            return false;
+        }
+
+        const auto size = static_cast<size_t>(status.st_size);
+        void *data = size == 0 ? MAP_FAILED : mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (data == MAP_FAILED) {
+            std::cerr << "Error: not a mutation log\n";
+            return false;
+        }
+
+        madvise(data, size, MADV_SEQUENTIAL);
+
+        size_t end = 0;
+        const bool read = decode(static_cast<const char *>(data), size, visitor, end);
+        munmap(data, size);
+
+        return read;
+    }
+
+    template<typename T>
+    MutationLog<T>::~MutationLog() {
+        commit();
+        close(_fd);
+    }
+
+    template<typename T>
+    void MutationLog<T>::record_value(LogOp op, const T &value) {
+        const size_t size = _buffer.size();
+
+        _buffer.resize(size + 1 + sizeof(T));
+        _buffer[size] = static_cast<char>(op);
+        std::memcpy(&_buffer[size + 1], &value, sizeof(T));
+        recorded();
+    }
+
+    template<typename T>
+    void MutationLog<T>::record_index(LogOp op, int32_t index) {
+        _buffer.push_back(static_cast<char>(op));
+
+        if (op == LogOp::RemoveIndex) {
+            const size_t size = _buffer.size();
+
+            _buffer.resize(size + sizeof(index));
+            std::memcpy(&_buffer[size], &index, sizeof(index));
+        }
+
+        recorded();
+    }
+
+    template<typename T>
+    bool MutationLog<T>::commit() {
+        if (_pending == 0) {
+            return true;
+        }
+
+        const auto length = static_cast<uint32_t>(_buffer.size() - group_header_size);
+        const uint32_t sum = checksum(_buffer.data() + group_header_size, length);
+
+        std::memcpy(&_buffer[0], &length, sizeof(length));
+        std::memcpy(&_buffer[4], &sum, sizeof(sum));
+
+        size_t written = 0;
+
+        while (written < _buffer.size()) {
+            const ssize_t count = write(_fd, _buffer.data() + written, _buffer.size() - written);
+
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+
+            if (count <= 0) {
+                break;
+            }
+
+            written += static_cast<size_t>(count);
+        }
+
+        if (written < _buffer.size() || fdatasync(_fd) != 0) {
+            // Cut the partial group, so that the next commit follows the last
+            // committed one.
+            std::cerr << "Error: cannot commit the mutation log\n";
+
+            if (ftruncate(_fd, static_cast<off_t>(_end)) == 0) {
+                lseek(_fd, static_cast<off_t>(_end), SEEK_SET);
+            }
+
+            return false;
+        }
+
+        _end += _buffer.size();
+        _buffer.resize(group_header_size);
+        _pending = 0;
+
+        return true;
+    }
+
+    template<typename T>
+    size_t MutationLog<T>::pending() const { return _pending; }
+
+    template<typename T>
+    MutationLog<T>::MutationLog(int fd, size_t end, size_t group)
+            : _fd(fd), _end(end), _group(group), _buffer(group_header_size) {
+    }
+
+    template<typename T>
+    template<typename Visitor>
+    bool MutationLog<T>::decode(const char *data, size_t size, Visitor &&visitor, size_t &end) {
+        uint16_t format = 0;
+        uint32_t order = 0;
+        uint32_t value_size = 0;
+
+        if (size < header_size || std::memcmp(data, "SLWL", 4) != 0) {
+            std::cerr << "Error: not a mutation log\n";
+            return false;
+        }
+
+        std::memcpy(&format, data + 4, sizeof(format));
+        std::memcpy(&order, data + 8, sizeof(order));
+        std::memcpy(&value_size, data + 12, sizeof(value_size));
+
+        if (format != version || order != 0x01020304) {
+            std::cerr << "Error: unsupported mutation log\n";
+            return false;
+        }
+
+        if (data[6] != ListFile<T>::kind() || value_size != sizeof(T)) {
+            std::cerr << "Error: the values of the mutation log are not of the type of the list\n";
+            return false;
+        }
+
+        size_t pos = header_size;
+        end = pos;
+
+        while (size - pos >= group_header_size) {
+            uint32_t length;
+            uint32_t sum;
+
+            std::memcpy(&length, data + pos, sizeof(length));
+            std::memcpy(&sum, data + pos + 4, sizeof(sum));
+
+            const char *records = data + pos + group_header_size;
+
+            // A torn group ends the log.
+            if (length > size - pos - group_header_size || checksum(records, length) != sum) {
+                break;
+            }
+
+            T value{};
+            int32_t index = 0;
+
+            for (size_t i = 0; i < length;) {
+                const auto op = static_cast<LogOp>(records[i++]);
+
+                switch (op) {
+                    case LogOp::Add:
+                    case LogOp::AddBack:
+                    case LogOp::AddFront:
+                    case LogOp::RemoveValue:
+                        if (length - i < sizeof(T)) {
+                            std::cerr << "Error: the mutation log is damaged\n";
+                            return false;
+                        }
+
+                        std::memcpy(&value, records + i, sizeof(T));
+                        i += sizeof(T);
+                        break;
+                    case LogOp::RemoveIndex:
+                        if (length - i < sizeof(index)) {
+                            std::cerr << "Error: the mutation log is damaged\n";
+                            return false;
+                        }
+
+                        std::memcpy(&index, records + i, sizeof(index));
+                        i += sizeof(index);
+                        break;
+                    case LogOp::RemoveFront:
+                    case LogOp::RemoveBack:
+                        break;
+                    default:
+                        std::cerr << "Error: the mutation log is damaged\n";
+                        return false;
+                }
+
+                if (!visitor(op, static_cast<const T &>(value), index)) {
+                    return false;
+                }
+            }
+
+            pos += group_header_size + length;
+            end = pos;
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    uint32_t MutationLog<T>::checksum(const char *data, size_t size) {
+        uint32_t hash = 2166136261U;
+
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ static_cast<uint8_t>(data[i])) * 16777619U;
+        }
+
+        return hash;
+    }
+
+    template<typename T>
+    void MutationLog<T>::recorded() {
+        if (++_pending >= _group) {
+            commit();
+        }
+    }
+
+} // namespace simple_list
@@ -32,157 +32,91 @@
 
 #pragma once
 
+#include <utility>
+
 namespace simple_list {
-    template<typename T>
-    Node<T>::Node()
-            : _value(0), _next(), _prev() {
+    template<typename T, typename Check>
+    Node<T, Check>::Node()
+            : _value() {
     }
 
-    template<typename T>
-    Node<T>::Node(T value)
+    template<typename T, typename Check>
+    Node<T, Check>::Node(const T &value)
             : _value(value) {
     }
 
-    template<typename R>
-    std::ostream &operator<<(std::ostream &stream, const Node <R> &node) {
+    template<typename T, typename Check>
+    Node<T, Check>::Node(T &&value)
+            : _value(std::move(value)) {
+    }
+
+    template<typename T, typename Check>
+    template<typename... Args>
+    Node<T, Check>::Node(InPlace, Args &&... args)
+            : _value(std::forward<Args>(args)...) {
+    }
+
+    template<typename R, typename C>
+    std::ostream &operator<<(std::ostream &stream, const Node <R, C> &node) {
         stream << node.value();
         return stream;
     }
 
-    template<typename T>
-    bool Node<T>::operator==(const Node <T> &b) const {
+    template<typename T, typename Check>
+    bool Node<T, Check>::operator==(const Node <T, Check> &b) const {
         return this == &b;
     }
 
-    template<typename T>
-    bool Node<T>::operator==(const SentinelNode <T> &b) const {
-        return this == &b;
+    template<typename T, typename Check>
+    bool Node<T, Check>::operator==(const SentinelNode <T, Check> &b) const {
+        return static_cast<const NodeBase<T, Check> *>(this) == static_cast<const NodeBase<T, Check> *>(&b);
     }
 
-    template<typename T>
-    bool Node<T>::operator!=(const Node <T> &b) const {
+    template<typename T, typename Check>
+    bool Node<T, Check>::operator!=(const Node <T, Check> &b) const {
         return this != &b;
     }
 
-    template<typename T>
-    bool Node<T>::operator<(const Node <T> &b) const {
+    template<typename T, typename Check>
+    bool Node<T, Check>::operator<(const Node <T, Check> &b) const {
         return this->_value < b._value;
     }
 
-    template<typename T>
-    bool Node<T>::operator<=(const Node <T> &b) const {
+    template<typename T, typename Check>
+    bool Node<T, Check>::operator<=(const Node <T, Check> &b) const {
         return this->_value <= b._value;
     }
 
-    template<typename T>
-    bool Node<T>::operator>(const Node <T> &b) const {
+    template<typename T, typename Check>
+    bool Node<T, Check>::operator>(const Node <T, Check> &b) const {
         return this->_value > b._value;
     }
 
-    template<typename T>
-    bool Node<T>::operator>=(const Node <T> &b) const {
+    template<typename T, typename Check>
+    bool Node<T, Check>::operator>=(const Node <T, Check> &b) const {
         return this->_value >= b._value;
     }
 
-    template<typename T>
-    T Node<T>::value() const { return _value; }
-
-    template<typename T>
-    void Node<T>::value(T val) { _value = val; }
-
-    template<typename T>
-    void Node<T>::clear() {
-        clear_prev();
-        clear_next();
-    }
+    template<typename T, typename Check>
+    const T &Node<T, Check>::value() const { return _value; }
 
-    template<typename T>
-    void Node<T>::clear_prev() { _has_prev = false; }
+    template<typename T, typename Check>
+    T &Node<T, Check>::value() { return _value; }
 
-    template<typename T>
-    bool Node<T>::has_next() const { return _has_next; }
+    template<typename T, typename Check>
+    void Node<T, Check>::value(const T &val) { _value = val; }
 
-    template<typename T>
-    bool Node<T>::has_prev() const { return _has_prev; }
-
-    template<typename T>
-    void Node<T>::clear_next() { _has_next = false; }
-
-    template<typename T>
-    Node <T> &Node<T>::next() {
-        if (!has_next()) {
-            std::cerr << "Error: node doesn't have next\n";
-            // throw std::runtime_error("Error: node doesn't have next");
-        }
-
-        return *_next;
-    }
-
-    template<typename T>
-    void Node<T>::next(Node <T> &node) {
-        this->check_self_assignment(node);
-
-        _has_next = true;
-        _next = &node;
-    }
-
-    template<typename T>
-    void Node<T>::append_next(Node <T> &node) {
-        this->check_self_assignment(node);
-
-        _has_next = true;
-        auto &k = next();
-        next(node);
-        node.next(k);
-    }
-
-    template<typename T>
-    Node <T> &Node<T>::prev() {
-        if (!has_prev()) {
-            std::cerr << "Error: node doesn't have prev\n";
-            // throw std::runtime_error("Error: node doesn't have prev");
-        }
-
-        return *_prev;
-    }
-
-    template<typename T>
-    void Node<T>::prev(Node <T> &node) {
-        this->check_self_assignment(node);
-
-        _has_prev = true;
-        _prev = &node;
-    }
-
-    template<typename T>
-    void Node<T>::append_prev(Node <T> &node) {
-        this->check_self_assignment(node);
-
-        _has_prev = true;
-        auto &k = prev();
-        prev(node);
-        node.prev(k);
-    }
-
-    template<typename T>
-    void Node<T>::check_self_assignment(const Node <T> &node) {
-        if (this == &node) {
-            std::cerr << "Warning: node self assignment.\n";
-            //// throw std::invalid_argument("Node self assignment.");
-        }
-    }
+    template<typename T, typename Check>
+    void Node<T, Check>::value(T &&val) { _value = std::move(val); }
 
-    template<typename T>
-    Node <T> &Node<T>::operator=(const Node <T> &obj) {
+    template<typename T, typename Check>
+    Node <T, Check> &Node<T, Check>::operator=(const Node <T, Check> &obj) {
         if (this == &obj) {
             return *this;
         }
 
+        NodeBase<T, Check>::operator=(obj);
         this->_value = obj._value;
-        this->_next = obj._next;
-        this->_prev = obj._prev;
-        this->_has_next = obj._has_next;
-        this->_has_prev = obj._has_prev;
 
         return *this;
     }
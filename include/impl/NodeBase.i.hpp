@@ -0,0 +1,92 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+namespace simple_list {
+
+    template<typename T, typename Check>
+    Node <T, Check> &NodeBase<T, Check>::next() {
+        Check::check(this->has_next(), "node doesn't have next");
+
+        return static_cast<Node<T, Check> &>(*this->_next);
+    }
+
+    template<typename T, typename Check>
+    void NodeBase<T, Check>::next(NodeBase <T, Check> &node) {
+        this->check_self_assignment(node);
+
+        this->_next = &node;
+    }
+
+    template<typename T, typename Check>
+    void NodeBase<T, Check>::append_next(Node <T, Check> &node) {
+        this->check_self_assignment(node);
+
+        if (this->has_next()) {
+            node.next(*this->_next);
+        }
+
+        next(node);
+    }
+
+    template<typename T, typename Check>
+    Node <T, Check> &NodeBase<T, Check>::prev() {
+        Check::check(this->has_prev(), "node doesn't have prev");
+
+        return static_cast<Node<T, Check> &>(*this->_prev);
+    }
+
+    template<typename T, typename Check>
+    void NodeBase<T, Check>::prev(NodeBase <T, Check> &node) {
+        this->check_self_assignment(node);
+
+        this->_prev = &node;
+    }
+
+    template<typename T, typename Check>
+    void NodeBase<T, Check>::append_prev(Node <T, Check> &node) {
+        this->check_self_assignment(node);
+
+        if (this->has_prev()) {
+            node.prev(*this->_prev);
+        }
+
+        prev(node);
+    }
+
+    template<typename T, typename Check>
+    void NodeBase<T, Check>::check_self_assignment(const NodeBase <T, Check> &node) {
+        Check::check(this != &node, "node self assignment");
+    }
+
+} // namespace simple_list
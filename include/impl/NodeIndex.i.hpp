@@ -0,0 +1,177 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <algorithm>
+
+namespace simple_list {
+
+    template<typename T, typename Hash>
+    NodeIndex<T, Hash>::NodeIndex(size_t expected) {
+        size_t capacity = 8;
+        while (capacity * 3 < expected * 4) {
+            capacity *= 2;
+        }
+
+        _slots.resize(capacity, Slot{0, nullptr});
+    }
+
+    template<typename T, typename Hash>
+    void NodeIndex<T, Hash>::insert(Node <T> &node) {
+        reserve_one();
+        place(Slot{hash(node.value()), &node});
+        _size++;
+    }
+
+    template<typename T, typename Hash>
+    Node <T> *NodeIndex<T, Hash>::insert_unique(Node <T> &node) {
+        reserve_one();
+
+        const uint64_t h = hash(node.value());
+        const size_t mask = _slots.size() - 1;
+
+        for (size_t i = h & mask;; i = (i + 1) & mask) {
+            Slot &slot = _slots[i];
+
+            if (slot.node == nullptr) {
+                slot = Slot{h, &node};
+                _size++;
+                return nullptr;
+            }
+
+            if (slot.hash == h && slot.node->value() == node.value()) {
+                return slot.node;
+            }
+        }
+    }
+
+    template<typename T, typename Hash>
+    Node <T> *NodeIndex<T, Hash>::find(const T &value) const {
+        const uint64_t h = hash(value);
+        const size_t mask = _slots.size() - 1;
+
+        for (size_t i = h & mask; _slots[i].node != nullptr; i = (i + 1) & mask) {
+            if (_slots[i].hash == h && _slots[i].node->value() == value) {
+                return _slots[i].node;
+            }
+        }
+
+        return nullptr;
+    }
+
+    template<typename T, typename Hash>
+    bool NodeIndex<T, Hash>::erase(const Node <T> &node) {
+        const size_t mask = _slots.size() - 1;
+        size_t i = hash(node.value()) & mask;
+
+        while (_slots[i].node != &node) {
+            if (_slots[i].node == nullptr) {
+                return false;
+            }
+
+            i = (i + 1) & mask;
+        }
+
+        // Backward shift deletion: move back every following node of the
+        // cluster that would not be found anymore once slot i is empty.
+        for (size_t j = (i + 1) & mask; _slots[j].node != nullptr; j = (j + 1) & mask) {
+            const size_t home = _slots[j].hash & mask;
+
+            if (((j - home) & mask) >= ((j - i) & mask)) {
+                _slots[i] = _slots[j];
+                i = j;
+            }
+        }
+
+        _slots[i].node = nullptr;
+        _size--;
+
+        return true;
+    }
+
+    template<typename T, typename Hash>
+    void NodeIndex<T, Hash>::clear() {
+        std::fill(_slots.begin(), _slots.end(), Slot{0, nullptr});
+        _size = 0;
+    }
+
+    template<typename T, typename Hash>
+    size_t NodeIndex<T, Hash>::size() const { return _size; }
+
+    template<typename T, typename Hash>
+    size_t NodeIndex<T, Hash>::memory() const {
+        return sizeof(*this) + _slots.capacity() * sizeof(Slot);
+    }
+
+    template<typename T, typename Hash>
+    uint64_t NodeIndex<T, Hash>::hash(const T &value) const {
+        // Finalizer of MurmurHash3.
+        auto h = static_cast<uint64_t>(_hasher(value));
+        h ^= h >> 33U;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33U;
+        h *= 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 33U;
+
+        return h;
+    }
+
+    template<typename T, typename Hash>
+    void NodeIndex<T, Hash>::reserve_one() {
+        if ((_size + 1) * 4 <= _slots.size() * 3) {
+            return;
+        }
+
+        std::vector<Slot> old(_slots.size() * 2, Slot{0, nullptr});
+        old.swap(_slots);
+
+        for (const auto &slot : old) {
+            if (slot.node != nullptr) {
+                place(slot);
+            }
+        }
+    }
+
+    template<typename T, typename Hash>
+    void NodeIndex<T, Hash>::place(const Slot &slot) {
+        const size_t mask = _slots.size() - 1;
+        size_t i = slot.hash & mask;
+
+        while (_slots[i].node != nullptr) {
+            i = (i + 1) & mask;
+        }
+
+        _slots[i] = slot;
+    }
+
+} // namespace simple_list
@@ -0,0 +1,180 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <utility>
+
+namespace simple_list {
+
+    template<typename T>
+    NodePool<T>::NodePool(size_t chunk, MemoryResource *resource)
+            : _resource(resource), _chunk(chunk == 0 ? 1 : chunk) {
+    }
+
+    template<typename T>
+    NodePool<T>::~NodePool() {
+        for (auto &chunk : _chunks) {
+            for (size_t i = 0; i < chunk.count; i++) {
+                if (chunk.alive[i]) {
+                    reinterpret_cast<Node<T> *>(&chunk.slots[i])->~Node<T>();
+                }
+            }
+
+            _resource->deallocate(chunk.slots, chunk.count * sizeof(Slot), alignof(Slot));
+            _resource->deallocate(chunk.alive, chunk.count * sizeof(bool), alignof(bool));
+        }
+    }
+
+    template<typename T>
+    template<typename... Args>
+    Node <T> *NodePool<T>::create(Args &&... args) {
+        Slot *slot = acquire();
+        Node<T> *node;
+
+        try {
+            node = new(slot) Node<T>(InPlace(), std::forward<Args>(args)...);
+        } catch (...) {
+            release(slot);
+            throw;
+        }
+
+        const Chunk *chunk = find(slot);
+        chunk->alive[static_cast<size_t>(slot - chunk->slots)] = true;
+        _size++;
+
+        return node;
+    }
+
+    template<typename T>
+    void NodePool<T>::reserve(size_t count) {
+        if (count == 0 || (!_chunks.empty() && _chunks.back().count - _used >= count)) {
+            return;
+        }
+
+        grow(std::max(count, _chunks.empty() ? _chunk : _capacity));
+    }
+
+    template<typename T>
+    void NodePool<T>::destroy(Node <T> *node) {
+        auto *slot = reinterpret_cast<Slot *>(node);
+        const Chunk *chunk = find(slot);
+
+        if (chunk == nullptr) {
+            std::cerr << "Error: node not created by the pool\n";
+            return;
+        }
+
+        node->~Node<T>();
+        chunk->alive[static_cast<size_t>(slot - chunk->slots)] = false;
+        release(slot);
+        _size--;
+    }
+
+    template<typename T>
+    bool NodePool<T>::owns(const Node <T> *node) const {
+        return find(reinterpret_cast<const Slot *>(node)) != nullptr;
+    }
+
+    template<typename T>
+    size_t NodePool<T>::size() const { return _size; }
+
+    template<typename T>
+    size_t NodePool<T>::capacity() const { return _capacity; }
+
+    template<typename T>
+    MemoryResource *NodePool<T>::resource() const { return _resource; }
+
+    template<typename T>
+    typename NodePool<T>::Slot *NodePool<T>::acquire() {
+        if (_free != nullptr) {
+            Slot *slot = _free;
+            _free = *reinterpret_cast<Slot **>(slot);
+
+            return slot;
+        }
+
+        if (_chunks.empty() || _used == _chunks.back().count) {
+            grow(_chunks.empty() ? _chunk : _capacity);
+        }
+
+        return &_chunks.back().slots[_used++];
+    }
+
+    template<typename T>
+    void NodePool<T>::grow(size_t count) {
+        // Room for the chunk first, so that nothing throws once it's allocated
+        // but not recorded.
+        _chunks.reserve(_chunks.size() + 1);
+
+        auto *slots = static_cast<Slot *>(_resource->allocate(count * sizeof(Slot), alignof(Slot)));
+        bool *alive;
+
+        try {
+            alive = static_cast<bool *>(_resource->allocate(count * sizeof(bool), alignof(bool)));
+        } catch (...) {
+            _resource->deallocate(slots, count * sizeof(Slot), alignof(Slot));
+            throw;
+        }
+
+        std::fill(alive, alive + count, false);
+        _chunks.push_back(Chunk{slots, alive, count});
+        _capacity += count;
+        _used = 0;
+    }
+
+    template<typename T>
+    void NodePool<T>::release(Slot *slot) {
+        new(slot) Slot *(_free);
+        _free = slot;
+    }
+
+    template<typename T>
+    const typename NodePool<T>::Chunk *NodePool<T>::find(const Slot *slot) const {
+        // The chunks double the capacity, so there are only a few of them.
+        const std::less<const Slot *> less;
+
+        for (const auto &chunk : _chunks) {
+            const Slot *begin = chunk.slots;
+
+            if (!less(slot, begin) && less(slot, begin + chunk.count)) {
+                return &chunk;
+            }
+        }
+
+        return nullptr;
+    }
+
+} // namespace simple_list
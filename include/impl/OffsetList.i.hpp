@@ -0,0 +1,393 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <cstring>
+#include <iostream>
+
+namespace simple_list {
+
+    template<typename T>
+    constexpr uint16_t OffsetList<T>::version;
+
+    template<typename T>
+    size_t OffsetList<T>::bytes(uint64_t capacity) {
+        return slots_offset() + static_cast<size_t>(capacity) * sizeof(Slot);
+    }
+
+    template<typename T>
+    void OffsetList<T>::format(void *region, uint64_t capacity) {
+        auto &header = *static_cast<Header *>(region);
+
+        std::memcpy(header.magic, "SLMP", sizeof(header.magic));
+        header.version = version;
+        header.kind = ListFile<T>::kind();
+        header.value_size = static_cast<uint32_t>(sizeof(T));
+        header.capacity = capacity;
+    }
+
+    template<typename T>
+    bool OffsetList<T>::valid(const void *region, size_t size) {
+        const auto &header = *static_cast<const Header *>(region);
+
+        if (size < sizeof(Header) || std::memcmp(header.magic, "SLMP", sizeof(header.magic)) != 0 ||
+            header.version != version) {
+            std::cerr << "Error: not a mapped list\n";
+            return false;
+        }
+
+        if (header.kind != ListFile<T>::kind() || header.value_size != sizeof(T)) {
+            std::cerr << "Error: the values of the mapped list are not of the type of the list\n";
+            return false;
+        }
+
+        if (bytes(header.capacity) > size || header.used > header.capacity || header.size > header.used) {
+            std::cerr << "Error: the mapped list is damaged\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    size_t OffsetList<T>::size() const { return static_cast<size_t>(header().size); }
+
+    template<typename T>
+    bool OffsetList<T>::empty() const { return header().size == 0; }
+
+    template<typename T>
+    size_t OffsetList<T>::capacity() const { return static_cast<size_t>(header().capacity); }
+
+    template<typename T>
+    T OffsetList<T>::front() const {
+        if (empty()) {
+            std::cerr << "Error: list is empty\n";
+            return T();
+        }
+
+        Links *sentinel = &header().sentinel;
+
+        return reinterpret_cast<Slot *>(follow(sentinel, sentinel->next))->value;
+    }
+
+    template<typename T>
+    T OffsetList<T>::back() const {
+        if (empty()) {
+            std::cerr << "Error: list is empty\n";
+            return T();
+        }
+
+        Links *sentinel = &header().sentinel;
+
+        return reinterpret_cast<Slot *>(follow(sentinel, sentinel->prev))->value;
+    }
+
+    template<typename T>
+    bool OffsetList<T>::add_back(const T &value) {
+        Slot *slot = acquire();
+
+        if (slot == nullptr) {
+            return false;
+        }
+
+        slot->value = value;
+        link(&header().sentinel, slot);
+
+        return true;
+    }
+
+    template<typename T>
+    bool OffsetList<T>::add_front(const T &value) {
+        Slot *slot = acquire();
+
+        if (slot == nullptr) {
+            return false;
+        }
+
+        Links *sentinel = &header().sentinel;
+
+        slot->value = value;
+        link(follow(sentinel, sentinel->next), slot);
+
+        return true;
+    }
+
+    template<typename T>
+    bool OffsetList<T>::add(const T &value) {
+        // The slot is taken first: growing can move the region.
+        Slot *slot = acquire();
+
+        if (slot == nullptr) {
+            return false;
+        }
+
+        Links *sentinel = &header().sentinel;
+        Links *pos = follow(sentinel, sentinel->next);
+
+        while (pos != sentinel && !(value < reinterpret_cast<Slot *>(pos)->value)) {
+            pos = follow(pos, pos->next);
+        }
+
+        slot->value = value;
+        link(pos, slot);
+
+        return true;
+    }
+
+    template<typename T>
+    T OffsetList<T>::remove_front() {
+        if (empty()) {
+            std::cerr << "Error: list is empty\n";
+            return T();
+        }
+
+        Links *sentinel = &header().sentinel;
+
+        return release(reinterpret_cast<Slot *>(follow(sentinel, sentinel->next)));
+    }
+
+    template<typename T>
+    T OffsetList<T>::remove_back() {
+        if (empty()) {
+            std::cerr << "Error: list is empty\n";
+            return T();
+        }
+
+        Links *sentinel = &header().sentinel;
+
+        return release(reinterpret_cast<Slot *>(follow(sentinel, sentinel->prev)));
+    }
+
+    template<typename T>
+    bool OffsetList<T>::remove_value(const T &value) {
+        Links *sentinel = &header().sentinel;
+
+        for (Links *pos = follow(sentinel, sentinel->next); pos != sentinel; pos = follow(pos, pos->next)) {
+            auto *slot = reinterpret_cast<Slot *>(pos);
+
+            if (slot->value == value) {
+                release(slot);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template<typename T>
+    template<typename Function>
+    size_t OffsetList<T>::consume_front(size_t count, Function &&function) {
+        Links *sentinel = &header().sentinel;
+        size_t consumed = 0;
+
+        for (; consumed < count && !empty(); consumed++) {
+            auto *slot = reinterpret_cast<Slot *>(follow(sentinel, sentinel->next));
+
+            function(static_cast<const T &>(slot->value));
+            release(slot);
+        }
+
+        return consumed;
+    }
+
+    template<typename T>
+    template<typename Function>
+    void OffsetList<T>::apply(Function &&function) const {
+        Links *sentinel = &header().sentinel;
+
+        for (Links *pos = follow(sentinel, sentinel->next); pos != sentinel; pos = follow(pos, pos->next)) {
+            function(static_cast<const T &>(reinterpret_cast<Slot *>(pos)->value));
+        }
+    }
+
+    template<typename T>
+    std::vector<T> OffsetList<T>::to_vector() const {
+        std::vector<T> values;
+        values.reserve(size());
+
+        apply([&values](const T &value) { values.push_back(value); });
+
+        return values;
+    }
+
+    template<typename T>
+    void OffsetList<T>::attach(void *region) {
+        _region = static_cast<char *>(region);
+    }
+
+    template<typename T>
+    bool OffsetList<T>::grow() {
+        return false;
+    }
+
+    template<typename T>
+    typename OffsetList<T>::Header &OffsetList<T>::header() const {
+        return *reinterpret_cast<Header *>(_region);
+    }
+
+    template<typename T>
+    bool OffsetList<T>::repair() const {
+        Header &h = header();
+
+        if (h.used > h.capacity) {
+            return false;
+        }
+
+        // link() and release() write a next link only to reach a slot that is
+        // in the ring, so the forward ring survives the death of a process in
+        // the middle of them, and the rest can be rebuilt from it.
+        std::vector<bool> linked(static_cast<size_t>(h.used), false);
+        const char *first = reinterpret_cast<const char *>(slot(0));
+        Links *sentinel = &h.sentinel;
+        Links *pos = sentinel;
+        uint64_t size = 0;
+
+        while (true) {
+            Links *next = follow(pos, pos->next);
+
+            if (next == sentinel) {
+                break;
+            }
+
+            const int64_t distance = reinterpret_cast<const char *>(next) - first;
+
+            if (distance < 0 || distance % static_cast<int64_t>(sizeof(Slot)) != 0) {
+                return false;
+            }
+
+            const auto i = static_cast<uint64_t>(distance) / sizeof(Slot);
+
+            if (i >= h.used || linked[i]) {
+                return false;
+            }
+
+            linked[i] = true;
+            next->prev = offset(next, pos);
+            size++;
+            pos = next;
+        }
+
+        sentinel->prev = offset(sentinel, pos);
+        h.size = size;
+        h.free = 0;
+
+        // The used slots out of the ring are free, even the ones lost by a
+        // process that died between acquire() and link().
+        for (uint64_t i = h.used; i > 0; i--) {
+            if (!linked[i - 1]) {
+                Links &links = slot(i - 1)->links;
+                links.next = static_cast<int64_t>(h.free);
+                links.prev = 0;
+                h.free = i;
+            }
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    constexpr size_t OffsetList<T>::slots_offset() {
+        return (sizeof(Header) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+    }
+
+    template<typename T>
+    typename OffsetList<T>::Links *OffsetList<T>::follow(const Links *links, int64_t offset) {
+        return reinterpret_cast<Links *>(const_cast<char *>(reinterpret_cast<const char *>(links)) + offset);
+    }
+
+    template<typename T>
+    int64_t OffsetList<T>::offset(const Links *from, const Links *to) {
+        return reinterpret_cast<const char *>(to) - reinterpret_cast<const char *>(from);
+    }
+
+    template<typename T>
+    typename OffsetList<T>::Slot *OffsetList<T>::acquire() {
+        if (header().free == 0 && header().used == header().capacity && !grow()) {
+            std::cerr << "Error: the mapped list is full\n";
+            return nullptr;
+        }
+
+        Header &h = header();
+
+        if (h.free != 0) {
+            Slot *free = slot(h.free - 1);
+            h.free = static_cast<uint64_t>(free->links.next);
+
+            return free;
+        }
+
+        return slot(h.used++);
+    }
+
+    template<typename T>
+    void OffsetList<T>::link(Links *pos, Slot *slot) {
+        Links *prev = follow(pos, pos->prev);
+        Links *links = &slot->links;
+
+        links->prev = offset(links, prev);
+        links->next = offset(links, pos);
+        prev->next = offset(prev, links);
+        pos->prev = offset(pos, links);
+        header().size++;
+    }
+
+    template<typename T>
+    T OffsetList<T>::release(Slot *slot) {
+        Links *links = &slot->links;
+        Links *prev = follow(links, links->prev);
+        Links *next = follow(links, links->next);
+        const T value = slot->value;
+
+        prev->next = offset(prev, next);
+        next->prev = offset(next, prev);
+
+        Header &h = header();
+        links->next = static_cast<int64_t>(h.free);
+        links->prev = 0;
+        h.free = index(slot) + 1;
+        h.size--;
+
+        return value;
+    }
+
+    template<typename T>
+    typename OffsetList<T>::Slot *OffsetList<T>::slot(uint64_t i) const {
+        return reinterpret_cast<Slot *>(_region + slots_offset()) + i;
+    }
+
+    template<typename T>
+    uint64_t OffsetList<T>::index(const Slot *slot) const {
+        return static_cast<uint64_t>(slot - reinterpret_cast<const Slot *>(_region + slots_offset()));
+    }
+
+} // namespace simple_list
@@ -32,131 +32,327 @@
 
 #pragma once
 
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
 namespace simple_list {
 
     template<typename T>
-    void OrderedList<T>::add(Node <T> &node) {
-        if (!this->head().has_next()) {
-            this->head().set(node);
+    OrderedList <T> *OrderedList<T>::create_from_array(T *array, size_t size) {
+        auto *list = new OrderedList<T>;
+        list->_allocated = true;
 
-            if (!this->tail().has_prev()) {
-                this->tail().set(node);
-            }
+        if (size == 0) {
+            return list;
+        }
 
-            this->_size++;
+        Node<T> *first;
+        Node<T> *last;
+        create_chain(array, size, first, last, new_node);
 
-            return;
+        list->splice(list->sentinel(), *first, *last);
+        list->_size = static_cast<int32_t>(size);
+
+        return list;
+    }
+
+    template<typename T>
+    OrderedList <T> *OrderedList<T>::create_from_array(T *array, size_t size, MemoryResource *resource) {
+        auto *list = new OrderedList<T>(resource);
+
+        if (size == 0) {
+            return list;
         }
 
-        add_aux(this->first(), node);
+        // The nodes are taken from the pool one after another, then sorted like
+        // the ones of the global heap.
+        Node<T> *first;
+        Node<T> *last;
+        list->reserve(size);
+        create_chain(array, size, first, last, [list](const T &value) { return &list->create_node(value); });
+
+        list->splice(list->sentinel(), *first, *last);
+        list->_size = static_cast<int32_t>(size);
+
+        return list;
     }
 
     template<typename T>
-    Node <T> &OrderedList<T>::remove_value(T value) {
-        if (this->empty()) {
-            std::cerr << "Error: list is empty\n";
+    OrderedList<T>::OrderedList(MemoryResource *resource) {
+        this->use_resource(resource);
+    }
+
+    template<typename T>
+    OrderedList <T> *OrderedList<T>::load(const std::string &path) {
+        auto *list = new OrderedList<T>;
+
+        if (!list->template load_from<true>(path)) {
+            delete list;
+            return nullptr;
+        }
+
+        return list;
+    }
+
+    template<typename T>
+    bool OrderedList<T>::replay(const std::string &path) {
+        AbstractMutationLog<T> *log = this->_log;
+        this->_log = nullptr;
+
+        const bool replayed = MutationLog<T>::read(path, [this](LogOp op, const T &value, int32_t) {
+            Node<T> *node = nullptr;
+
+            switch (op) {
+                case LogOp::Add:
+                    emplace(value);
+                    return true;
+                case LogOp::RemoveFront:
+                    node = this->empty() ? nullptr : &remove_front();
+                    break;
+                case LogOp::RemoveValue:
+                    node = remove_value(value);
+                    break;
+                case LogOp::AddBack:
+                case LogOp::AddFront:
+                case LogOp::RemoveBack:
+                case LogOp::RemoveIndex:
+                    break;
+            }
+
+            if (node == nullptr) {
+                std::cerr << "Error: the mutation log doesn't match the list\n";
+                return false;
+            }
+
+            this->dispose(*node);
+
+            return true;
+        });
+
+        this->_log = log;
+
+        return replayed;
+    }
+
+    template<typename T>
+    OrderedList <T> *OrderedList<T>::create_from_array(T *array, size_t size, ThreadPool &pool) {
+        auto *list = new OrderedList<T>;
+        list->_allocated = true;
+
+        if (size == 0) {
+            return list;
         }
 
-        if (value < 0) {
-            std::cerr << "Error: invalid range\n";
+        const size_t parts = std::min(pool.size(), size);
+        std::vector<Node<T> *> firsts(parts);
+        std::vector<Node<T> *> lasts(parts);
+        std::vector<std::future<void>> chains;
+        chains.reserve(parts);
+
+        size_t begin = 0;
+        for (size_t part = 0; part < parts; part++) {
+            const size_t length = size / parts + (part < size % parts ? 1 : 0);
+
+            chains.push_back(pool.submit([array, begin, length, &firsts, &lasts, part] {
+                create_chain(array + begin, length, firsts[part], lasts[part], new_node);
+            }));
+
+            begin += length;
         }
 
-        if (this->first().value() == value) {
-            return remove_front();
+        for (auto &chain : chains) {
+            chain.get();
         }
 
-        return remove_value_aux(this->first().next(), value);
+        ListSort<T>::parallel_merge(pool, firsts, lasts, std::less<T>());
+
+        list->splice(list->sentinel(), *firsts[0], *lasts[0]);
+        list->_size = static_cast<int32_t>(size);
+
+        return list;
     }
 
     template<typename T>
-    Node <T> &OrderedList<T>::remove_front() {
-        if (this->empty()) {
-            std::cerr << "Error: list is empty\n";
+    OrderedList <T> *OrderedList<T>::create_from_array(T *array, size_t size, ThreadPool &pool,
+                                                        MemoryResource *resource) {
+        auto *list = new OrderedList<T>(resource);
+
+        if (size == 0) {
+            return list;
         }
 
-        Node<T> &k = this->first();
+        const size_t parts = std::min(pool.size(), size);
+        std::vector<Node<T> *> firsts(parts);
+        std::vector<Node<T> *> lasts(parts);
+        std::vector<std::future<void>> chains;
+        chains.reserve(parts);
+        list->reserve(size);
 
-        if (k.has_next()) {
-            this->head().set(k.next());
-            k.next().clear_prev();
-        } else {
-            this->_head = this->_tail;
-            this->head().clear();
-            this->tail().clear();
+        // Each slice is sorted by a worker while the next one is created here.
+        size_t begin = 0;
+        for (size_t part = 0; part < parts; part++) {
+            const size_t length = size / parts + (part < size % parts ? 1 : 0);
+
+            link_chain(array + begin, length, firsts[part], lasts[part],
+                       [list](const T &value) { return &list->create_node(value); });
+            chains.push_back(pool.submit([&firsts, &lasts, part] {
+                DefaultSort<T>::sort(firsts[part], lasts[part]);
+            }));
+
+            begin += length;
         }
 
-        k.clear();
-        this->_size--;
+        for (auto &chain : chains) {
+            chain.get();
+        }
 
-        return k;
+        ListSort<T>::parallel_merge(pool, firsts, lasts, std::less<T>());
+
+        list->splice(list->sentinel(), *firsts[0], *lasts[0]);
+        list->_size = static_cast<int32_t>(size);
+
+        return list;
     }
 
     template<typename T>
-    void OrderedList<T>::add_aux(Node <T> &cur, Node <T> &node) {
-        if (node < cur) {
-            if (cur == this->first()) {
-                node.next(cur);
-                cur.prev(node);
-                this->head().set(node);
-
-                this->_size++;
-                return;
-            }
+    template<typename Create>
+    void OrderedList<T>::link_chain(T *array, size_t size, Node <T> *&first, Node <T> *&last, Create create) {
+        first = create(array[0]);
+        last = first;
 
-            auto &prev = cur.prev();
-            node.next(cur);
-            cur.prev(node);
-            node.prev(prev);
-            node.prev().next(node);
+        for (size_t i = 1; i < size; i++) {
+            auto *node = create(array[i]);
+            last->next(*node);
+            last = node;
+        }
+    }
 
-            this->_size++;
-            return;
+    template<typename T>
+    template<typename Create>
+    void OrderedList<T>::create_chain(T *array, size_t size, Node <T> *&first, Node <T> *&last, Create create) {
+        link_chain(array, size, first, last, create);
+        DefaultSort<T>::sort(first, last);
+    }
+
+    template<typename T>
+    Node <T> *OrderedList<T>::new_node(const T &value) {
+        return new Node<T>(value);
+    }
+
+    template<typename T>
+    void OrderedList<T>::add(Node <T> &node) {
+        if (this->_log) {
+            this->_log->record_value(LogOp::Add, node.value());
         }
 
-        if (cur == this->last()) {
-            cur.next(node);
-            node.clear_next();
-            this->tail().clear();
-            this->tail().set(node);
-            node.prev(cur);
+        if (this->jumps_valid()) {
+            // The table is sorted as the list, so the position is found with a
+            // binary search instead of a walk that misses the cache at every node.
+            auto &jumps = this->_jumps;
+            const auto it = std::upper_bound(jumps.begin(), jumps.end(), &node,
+                                             [](const Node<T> *a, const Node<T> *b) { return *a < *b; });
+            NodeBase<T> &pos = it == jumps.end() ? static_cast<NodeBase<T> &>(this->sentinel()) : **it;
 
+            node.link(*pos.prev_link(), pos);
             this->_size++;
+            this->_version++;
+            jumps.insert(it, &node);
+            this->_jumps_version = this->_version;
+
             return;
         }
 
-        add_aux(cur.next(), node);
+        // The sentinel closes the ring, so it is also the position after the
+        // greatest values.
+        NodeBase<T> *pos = NodeBase<T>::find_if(this->sentinel(), [&node](NodeBase<T> &link) {
+            return node < static_cast<Node<T> &>(link);
+        });
+
+        node.link(*pos->prev_link(), *pos);
+        this->_size++;
+        this->_version++;
     }
 
     template<typename T>
-    Node <T> &OrderedList<T>::remove_value_aux(Node <T> &cur, T value) {
-        if (cur == this->tail()) {
-            std::cerr << "Error: value not found";
-        }
-
-        if (cur.value() == value) {
-            if (cur == this->last()) {
-                this->tail().set(cur.prev());
-                cur.prev().clear_next();
-            } else {
-                Node<T> &prev = cur.prev();
-                Node<T> &next = cur.next();
-                prev.next(cur.next());
-                next.prev(prev);
+    template<typename... Args>
+    Node <T> &OrderedList<T>::emplace(Args &&... args) {
+        Node<T> &node = this->create_node(std::forward<Args>(args)...);
+        add(node);
+
+        return node;
+    }
+
+    template<typename T>
+    Node <T> *OrderedList<T>::remove_value(const T &value) {
+        if (this->jumps_valid()) {
+            auto &jumps = this->_jumps;
+            const auto it = std::lower_bound(jumps.begin(), jumps.end(), value,
+                                             [](const Node<T> *a, const T &b) { return a->value() < b; });
+
+            if (it == jumps.end() || !((*it)->value() == value)) {
+                return nullptr;
             }
 
-            cur.clear();
+            Node<T> &cur = **it;
+
+            cur.unlink();
             this->_size--;
+            this->_version++;
+            jumps.erase(it);
+            this->_jumps_version = this->_version;
 
-            if (this->empty()) {
-                this->_head = this->_tail;
-                this->head().clear();
-                this->tail().clear();
+            if (this->_log) {
+                this->_log->record_value(LogOp::RemoveValue, value);
             }
 
-            return cur;
+            return &cur;
         }
 
-        return remove_value_aux(cur.next(), value);
+        NodeBase<T> *pos = this->sentinel().next_link();
+
+        while (pos != &this->sentinel()) {
+            auto &cur = static_cast<Node<T> &>(*pos);
+
+            if (cur.value() == value) {
+                cur.unlink();
+                this->_size--;
+                this->_version++;
+
+                if (this->_log) {
+                    this->_log->record_value(LogOp::RemoveValue, value);
+                }
+
+                return &cur;
+            }
+
+            if (value < cur.value()) {
+                break;
+            }
+
+            pos = pos->next_link();
+        }
+
+        return nullptr;
+    }
+
+    template<typename T>
+    Node <T> &OrderedList<T>::remove_front() {
+        if (this->empty()) {
+            std::cerr << "Error: list is empty\n";
+        }
+
+        Node<T> &k = this->first();
+
+        k.unlink();
+        this->_size--;
+        this->_version++;
+
+        if (this->_log) {
+            this->_log->record_index(LogOp::RemoveFront, 0);
+        }
+
+        return k;
     }
 
 } // namespace simple_list
@@ -0,0 +1,97 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+#pragma once
+
+namespace simple_list {
+
+    template<typename Derived>
+    void RingLinks<Derived>::clear() {
+        clear_prev();
+        clear_next();
+    }
+
+    template<typename Derived>
+    void RingLinks<Derived>::clear_prev() { _prev = nullptr; }
+
+    template<typename Derived>
+    void RingLinks<Derived>::clear_next() { _next = nullptr; }
+
+    template<typename Derived>
+    bool RingLinks<Derived>::has_next() const { return _next != nullptr; }
+
+    template<typename Derived>
+    bool RingLinks<Derived>::has_prev() const { return _prev != nullptr; }
+
+    template<typename Derived>
+    Derived *RingLinks<Derived>::next_link() const { return _next; }
+
+    template<typename Derived>
+    Derived *RingLinks<Derived>::prev_link() const { return _prev; }
+
+    template<typename Derived>
+    void RingLinks<Derived>::link(Derived &prev, Derived &next) {
+        _prev = &prev;
+        _next = &next;
+        prev._next = self();
+        next._prev = self();
+    }
+
+    template<typename Derived>
+    void RingLinks<Derived>::unlink() {
+        _prev->_next = _next;
+        _next->_prev = _prev;
+        _prev = nullptr;
+        _next = nullptr;
+    }
+
+    template<typename Derived>
+    void RingLinks<Derived>::reset() {
+        _next = self();
+        _prev = self();
+    }
+
+    template<typename Derived>
+    template<typename Predicate>
+    Derived *RingLinks<Derived>::find_if(Derived &sentinel, Predicate before) {
+        Derived *pos = sentinel._next;
+
+        while (pos != &sentinel && !before(*pos)) {
+            pos = pos->_next;
+        }
+
+        return pos;
+    }
+
+    template<typename Derived>
+    Derived *RingLinks<Derived>::self() { return static_cast<Derived *>(this); }
+
+} // namespace simple_list
@@ -29,41 +29,17 @@
  *
  * @file
  */
-
 #pragma once
 
-#include <iostream>
-
 namespace simple_list {
 
-    template<typename T>
-    SentinelNode<T>::SentinelNode(SENTINEL_TYPE type)
-            : _type(type) {
+    template<typename T, typename Check>
+    SentinelNode<T, Check>::SentinelNode() {
+        this->reset();
     }
 
-    template<typename T>
-    void SentinelNode<T>::set(Node <T> &obj) {
-        switch (_type) {
-            case HEAD:
-                this->next(obj);
-                break;
-
-            case TAIL:
-                this->prev(obj);
-                break;
-
-            case NOT_SET:
-                std::cerr << "\nError: this node needs to be set to HEAD or TAIL";
-                break;
-        }
-    }
-
-    template<typename T>
-    SentinelNode <T> &SentinelNode<T>::operator=(const SentinelNode <T> &obj) {
-        if (this == &obj) {
-            return *this;
-        }
-
-        return *this;
+    template<typename T, typename Check>
+    bool SentinelNode<T, Check>::empty() const {
+        return this->_next == this;
     }
 } // namespace simple_list
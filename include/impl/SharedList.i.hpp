@@ -0,0 +1,335 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace simple_list {
+
+    template<typename T>
+    SharedList <T> *SharedList<T>::create(const std::string &name, uint64_t capacity) {
+        const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+
+        if (fd < 0) {
+            std::cerr << "Error: cannot create the shared list " << name << "\n";
+            return nullptr;
+        }
+
+        if (capacity == 0) {
+            capacity = 1;
+        }
+
+        // A new segment is zeroed by ftruncate, that is an empty ring.
+        const size_t size = region_offset() + OffsetList<T>::bytes(capacity);
+        void *mapping = ftruncate(fd, static_cast<off_t>(size)) != 0
+                        ? MAP_FAILED : mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if (mapping == MAP_FAILED) {
+            std::cerr << "Error: cannot create the shared list " << name << "\n";
+            shm_unlink(name.c_str());
+            return nullptr;
+        }
+
+        auto &block = *static_cast<Control *>(mapping);
+        pthread_mutexattr_t mutex_attr;
+        pthread_condattr_t cond_attr;
+
+        pthread_mutexattr_init(&mutex_attr);
+        pthread_mutexattr_setpshared(&mutex_attr, PTHREAD_PROCESS_SHARED);
+        pthread_mutexattr_setrobust(&mutex_attr, PTHREAD_MUTEX_ROBUST);
+        pthread_mutex_init(&block.mutex, &mutex_attr);
+        pthread_mutexattr_destroy(&mutex_attr);
+
+        pthread_condattr_init(&cond_attr);
+        pthread_condattr_setpshared(&cond_attr, PTHREAD_PROCESS_SHARED);
+        pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+        pthread_cond_init(&block.added, &cond_attr);
+        pthread_condattr_destroy(&cond_attr);
+
+        OffsetList<T>::format(static_cast<char *>(mapping) + region_offset(), capacity);
+
+        // The magic is written last, so open rejects a segment still being
+        // created.
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(block.magic, "SLSH", sizeof(block.magic));
+
+        return new SharedList<T>(mapping, size);
+    }
+
+    template<typename T>
+    SharedList <T> *SharedList<T>::open(const std::string &name) {
+        const int fd = shm_open(name.c_str(), O_RDWR, 0);
+        struct stat status{};
+
+        if (fd < 0 || fstat(fd, &status) != 0) {
+            std::cerr << "Error: cannot open the shared list " << name << "\n";
+
+            if (fd >= 0) {
+                close(fd);
+            }
+
+            return nullptr;
+        }
+
+        const auto size = static_cast<size_t>(status.st_size);
+        void *mapping = size <= region_offset()
+                        ? MAP_FAILED : mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if (mapping == MAP_FAILED || std::memcmp(static_cast<Control *>(mapping)->magic, "SLSH", 4) != 0) {
+            std::cerr << "Error: " << name << " is not a shared list\n";
+
+            if (mapping != MAP_FAILED) {
+                munmap(mapping, size);
+            }
+
+            return nullptr;
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (!OffsetList<T>::valid(static_cast<char *>(mapping) + region_offset(), size - region_offset())) {
+            munmap(mapping, size);
+            return nullptr;
+        }
+
+        return new SharedList<T>(mapping, size);
+    }
+
+    template<typename T>
+    bool SharedList<T>::destroy(const std::string &name) {
+        if (shm_unlink(name.c_str()) != 0) {
+            std::cerr << "Error: cannot remove the shared list " << name << "\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    SharedList<T>::~SharedList() {
+        munmap(_mapping, _bytes);
+    }
+
+    template<typename T>
+    size_t SharedList<T>::size() const {
+        Guard guard(*this);
+
+        if (!guard.locked()) {
+            return 0;
+        }
+
+        return OffsetList<T>::size();
+    }
+
+    template<typename T>
+    bool SharedList<T>::empty() const {
+        Guard guard(*this);
+
+        if (!guard.locked()) {
+            return true;
+        }
+
+        return OffsetList<T>::empty();
+    }
+
+    template<typename T>
+    bool SharedList<T>::add_back(const T &value) {
+        return add_back(&value, 1) == 1;
+    }
+
+    template<typename T>
+    size_t SharedList<T>::add_back(const T *values, size_t count) {
+        size_t added = 0;
+
+        {
+            Guard guard(*this);
+
+            if (!guard.locked()) {
+                return 0;
+            }
+
+            // A full list is checked here, not reported as an error by
+            // OffsetList: it only means that the consumer is behind.
+            while (added < count && OffsetList<T>::size() < this->capacity()) {
+                OffsetList<T>::add_back(values[added++]);
+            }
+        }
+
+        if (added > 0) {
+            pthread_cond_broadcast(&control().added);
+        }
+
+        return added;
+    }
+
+    template<typename T>
+    bool SharedList<T>::remove_front(T &value) {
+        return remove_front(&value, 1) == 1;
+    }
+
+    template<typename T>
+    size_t SharedList<T>::remove_front(T *values, size_t count) {
+        size_t removed = 0;
+
+        consume_front(count, [values, &removed](const T &value) { values[removed++] = value; });
+
+        return removed;
+    }
+
+    template<typename T>
+    template<typename Function>
+    size_t SharedList<T>::consume_front(size_t count, Function &&function) {
+        Guard guard(*this);
+
+        if (!guard.locked()) {
+            return 0;
+        }
+
+        return OffsetList<T>::consume_front(count, std::forward<Function>(function));
+    }
+
+    template<typename T>
+    bool SharedList<T>::wait(uint32_t milliseconds) const {
+        timespec deadline{};
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += static_cast<time_t>(milliseconds / 1000);
+        deadline.tv_nsec += static_cast<long>(milliseconds % 1000) * 1000000L;
+
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        Guard guard(*this);
+
+        if (!guard.locked()) {
+            return false;
+        }
+
+        while (OffsetList<T>::empty()) {
+            const int result = pthread_cond_timedwait(&control().added, &control().mutex, &deadline);
+
+            if (result == ETIMEDOUT) {
+                break;
+            }
+
+            if (!guard.acquire(result)) {
+                return false;
+            }
+        }
+
+        return !OffsetList<T>::empty();
+    }
+
+    template<typename T>
+    std::vector<T> SharedList<T>::to_vector() const {
+        Guard guard(*this);
+
+        if (!guard.locked()) {
+            return {};
+        }
+
+        return OffsetList<T>::to_vector();
+    }
+
+    template<typename T>
+    SharedList<T>::Guard::Guard(const SharedList<T> &list)
+            : _list(list), _locked(false) {
+        acquire(pthread_mutex_lock(&_list.control().mutex));
+    }
+
+    template<typename T>
+    SharedList<T>::Guard::~Guard() {
+        if (_locked) {
+            pthread_mutex_unlock(&_list.control().mutex);
+        }
+    }
+
+    template<typename T>
+    bool SharedList<T>::Guard::locked() const {
+        return _locked;
+    }
+
+    template<typename T>
+    bool SharedList<T>::Guard::acquire(int result) {
+        pthread_mutex_t &mutex = _list.control().mutex;
+        _locked = result == 0 || result == EOWNERDEAD;
+
+        // The dead owner may have been changing the links. The list is rebuilt
+        // from its forward ring and taken over, unless the ring itself is
+        // damaged: then unlocking without making the mutex consistent makes
+        // every later lock fail with ENOTRECOVERABLE.
+        if (result == EOWNERDEAD && (!_list.repair() || pthread_mutex_consistent(&mutex) != 0)) {
+            pthread_mutex_unlock(&mutex);
+            _locked = false;
+            std::cerr << "Error: a process died while changing the shared list, that is now broken\n";
+            return false;
+        }
+
+        if (result == ENOTRECOVERABLE) {
+            std::cerr << "Error: the shared list is broken\n";
+        } else if (!_locked) {
+            std::cerr << "Error: cannot lock the shared list\n";
+        }
+
+        return _locked;
+    }
+
+    template<typename T>
+    constexpr size_t SharedList<T>::region_offset() {
+        return (sizeof(Control) + 63) / 64 * 64;
+    }
+
+    template<typename T>
+    SharedList<T>::SharedList(void *mapping, size_t bytes)
+            : _mapping(mapping), _bytes(bytes) {
+        this->attach(static_cast<char *>(mapping) + region_offset());
+    }
+
+    template<typename T>
+    typename SharedList<T>::Control &SharedList<T>::control() const {
+        return *static_cast<Control *>(_mapping);
+    }
+
+} // namespace simple_list
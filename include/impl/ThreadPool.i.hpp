@@ -0,0 +1,103 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+#include <memory>
+
+namespace simple_list {
+
+    inline ThreadPool::ThreadPool(size_t threads) {
+        if (threads == 0) {
+            threads = 1;
+        }
+
+        _workers.reserve(threads);
+        for (size_t i = 0; i < threads; i++) {
+            _workers.emplace_back([this] { work(); });
+        }
+    }
+
+    inline ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+
+        _ready.notify_all();
+
+        for (auto &worker : _workers) {
+            worker.join();
+        }
+    }
+
+    inline size_t ThreadPool::size() const { return _workers.size(); }
+
+    template<typename F>
+    auto ThreadPool::submit(F &&task) -> std::future<decltype(task())> {
+        using R = decltype(task());
+
+        // std::function needs a copyable target, the packaged task is not.
+        auto packaged = std::make_shared<std::packaged_task<R()>>(std::forward<F>(task));
+        auto future = packaged->get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _tasks.emplace([packaged] { (*packaged)(); });
+        }
+
+        _ready.notify_one();
+
+        return future;
+    }
+
+    inline void ThreadPool::work() {
+        while (true) {
+            std::function<void()> task;
+
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _ready.wait(lock, [this] { return _stop || !_tasks.empty(); });
+
+                if (_tasks.empty()) {
+                    return;
+                }
+
+                task = std::move(_tasks.front());
+                _tasks.pop();
+            }
+
+            task();
+        }
+    }
+
+} // namespace simple_list
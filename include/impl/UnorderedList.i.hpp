@@ -32,23 +32,18 @@
 
 #pragma once
 
-namespace simple_list {
+#include <algorithm>
+#include <iostream>
+#include <utility>
 
-    template<typename T>
-    UnorderedList<T>::~UnorderedList() {
-        if (this->_allocated) {
-            this->apply([](Node<T> &node) { delete &node; });
-        }
-    }
+namespace simple_list {
 
     template<typename T>
     UnorderedList <T> *UnorderedList<T>::create_from_array(T *array, size_t size) {
         auto *list = new UnorderedList<T>;
 
         for (size_t i = 0; i < size; i++) {
-            T value = array[i];
-            auto *node = new sl::Node<T>(value);
-            list->add_back(*node);
+            list->add_back(*new Node<T>(array[i]));
         }
 
         list->_allocated = true;
@@ -56,6 +51,83 @@ namespace simple_list {
         return list;
     }
 
+    template<typename T>
+    UnorderedList <T> *UnorderedList<T>::create_from_array(T *array, size_t size, MemoryResource *resource) {
+        auto *list = new UnorderedList<T>(resource);
+        list->assign_from(array, size);
+
+        return list;
+    }
+
+    template<typename T>
+    UnorderedList<T>::UnorderedList(MemoryResource *resource) {
+        this->use_resource(resource);
+    }
+
+    template<typename T>
+    UnorderedList <T> *UnorderedList<T>::load(const std::string &path) {
+        auto *list = new UnorderedList<T>;
+
+        if (!list->template load_from<false>(path)) {
+            delete list;
+            return nullptr;
+        }
+
+        return list;
+    }
+
+    template<typename T>
+    bool UnorderedList<T>::replay(const std::string &path) {
+        AbstractMutationLog<T> *log = this->_log;
+        this->_log = nullptr;
+
+        const bool replayed = MutationLog<T>::read(path, [this](LogOp op, const T &value, int32_t index) {
+            Node<T> *node = nullptr;
+
+            switch (op) {
+                case LogOp::Add:
+                case LogOp::AddBack:
+                    emplace_back(value);
+                    return true;
+                case LogOp::AddFront:
+                    emplace_front(value);
+                    return true;
+                case LogOp::RemoveFront:
+                    node = this->empty() ? nullptr : &remove_front();
+                    break;
+                case LogOp::RemoveBack:
+                    node = this->empty() ? nullptr : &remove_back();
+                    break;
+                case LogOp::RemoveIndex:
+                    node = remove(index);
+                    break;
+                case LogOp::RemoveValue:
+                    // The first node with the value, like remove_value without
+                    // the index, whatever the index of this list finds.
+                    node = scan(value);
+
+                    if (node != nullptr) {
+                        unlink(*node);
+                    }
+
+                    break;
+            }
+
+            if (node == nullptr) {
+                std::cerr << "Error: the mutation log doesn't match the list\n";
+                return false;
+            }
+
+            this->dispose(*node);
+
+            return true;
+        });
+
+        this->_log = log;
+
+        return replayed;
+    }
+
     template<typename T>
     void UnorderedList<T>::add(Node <T> &node) {
         this->add_back(node);
@@ -63,16 +135,15 @@ namespace simple_list {
 
     template<typename T>
     void UnorderedList<T>::add_back(Node <T> &node) {
-        if (!List<T>::tail().has_prev()) {
-            this->tail().set(node);
+        if (this->_log) {
+            this->_log->record_value(LogOp::AddBack, node.value());
+        }
 
-            if (!List<T>::head().has_next()) {
-                this->head().set(node);
-            }
-        } else {
-            List<T>::last().next(node);
-            node.prev(List<T>::last());
-            this->tail().set(node);
+        node.link(*this->sentinel().prev_link(), this->sentinel());
+        this->_version++;
+
+        if (_index) {
+            _index->insert(node);
         }
 
         this->_size++;
@@ -80,19 +151,105 @@ namespace simple_list {
 
     template<typename T>
     void UnorderedList<T>::add_front(Node <T> &node) {
-        if (!List<T>::head().has_next()) {
-            this->head().set(node);
+        if (this->_log) {
+            this->_log->record_value(LogOp::AddFront, node.value());
+        }
+
+        link_front(node);
+    }
+
+    template<typename T>
+    template<typename... Args>
+    Node <T> &UnorderedList<T>::emplace(Args &&... args) {
+        return emplace_back(std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    template<typename... Args>
+    Node <T> &UnorderedList<T>::emplace_back(Args &&... args) {
+        Node<T> &node = this->create_node(std::forward<Args>(args)...);
+        add_back(node);
+
+        return node;
+    }
+
+    template<typename T>
+    template<typename... Args>
+    Node <T> &UnorderedList<T>::emplace_front(Args &&... args) {
+        Node<T> &node = this->create_node(std::forward<Args>(args)...);
+        add_front(node);
 
-            if (!List<T>::tail().has_prev()) {
-                this->tail().set(node);
+        return node;
+    }
+
+    template<typename T>
+    void UnorderedList<T>::assign_from(const T *array, size_t size) {
+        // The reused nodes change value in place, which no record describes, so
+        // the whole operation is logged as the removal of the old values and
+        // the addition of the new ones.
+        AbstractMutationLog<T> *log = this->_log;
+        this->_log = nullptr;
+
+        if (log) {
+            for (int32_t i = 0; i < this->size(); i++) {
+                log->record_index(LogOp::RemoveBack, 0);
+            }
+
+            for (size_t i = 0; i < size; i++) {
+                log->record_value(LogOp::AddBack, array[i]);
             }
-        } else {
-            List<T>::first().prev(node);
-            node.next(List<T>::first());
-            this->head().set(node);
         }
 
-        this->_size++;
+        while (static_cast<size_t>(this->size()) > size) {
+            discard(this->last());
+        }
+
+        const auto kept = static_cast<size_t>(this->size());
+        Node<T> *node = kept == 0 ? nullptr : &this->first();
+
+        for (size_t i = 0; i < kept; i++) {
+            Node<T> *next = i + 1 < kept ? &node->next() : nullptr;
+
+            // The index hashes the values, so a node is indexed again with its
+            // new value.
+            if (_index) {
+                _index->erase(*node);
+            }
+
+            node->value(array[i]);
+
+            if (_index) {
+                _index->insert(*node);
+            }
+
+            node = next;
+        }
+
+        if (size > kept) {
+            this->reserve(size - kept);
+        }
+
+        for (size_t i = kept; i < size; i++) {
+            emplace_back(array[i]);
+        }
+
+        this->_log = log;
+    }
+
+    template<typename T>
+    void UnorderedList<T>::add_back_chain(Node <T> &first, Node <T> &last, int32_t count) {
+        this->splice(this->sentinel(), first, last);
+        index_chain(first, last);
+
+        this->_size += count;
+    }
+
+    template<typename T>
+    void UnorderedList<T>::add_front_chain(Node <T> &first, Node <T> &last, int32_t count) {
+        this->splice(*this->sentinel().next_link(), first, last);
+        index_chain(first, last);
+
+        this->_size += count;
     }
 
     template<typename T>
@@ -102,16 +259,12 @@ namespace simple_list {
         }
 
         auto &node = this->last();
+        unlink(node);
 
-        if (node.has_prev()) {
-            this->tail().set(node.prev());
-        } else {
-            this->_tail = this->_head;
+        if (this->_log) {
+            this->_log->record_index(LogOp::RemoveBack, 0);
         }
 
-        node.clear();
-        this->_size--;
-
         return node;
     }
 
@@ -122,34 +275,354 @@ namespace simple_list {
         }
 
         auto &node = List<T>::first();
+        unlink(node);
+
+        if (this->_log) {
+            this->_log->record_index(LogOp::RemoveFront, 0);
+        }
+
+        return node;
+    }
+
+    template<typename T>
+    Node <T> *UnorderedList<T>::remove(int32_t index) {
+        if (index < 0 || index >= this->size()) {
+            std::cerr << "Error: index out of range\n";
+            return nullptr;
+        }
+
+        const auto position = static_cast<size_t>(index);
+        Node<T> *node;
+
+        if (this->jumps_valid() && position < this->_jumps.size()) {
+            node = this->_jumps[position];
 
-        if (node.has_next()) {
-            this->head().set(node.next());;
+            unlink(*node);
+            this->_jumps.erase(this->_jumps.begin() + index);
+            this->_jumps_version = this->_version;
         } else {
-            this->_head = this->_tail;
+            node = &remove_aux(index, List<T>::first());
         }
 
-        node.clear();
-        this->_size--;
+        if (this->_log) {
+            this->_log->record_index(LogOp::RemoveIndex, index);
+        }
+
+        return node;
+    }
+
+    template<typename T>
+    Node <T> &UnorderedList<T>::remove(Node <T> &node) {
+        if (this->empty()) {
+            std::cerr << "Error: empty list";
+        }
+
+        unlink(node);
 
         return node;
     }
 
     template<typename T>
-    Node <T> &UnorderedList<T>::remove(int32_t index) {
-        if (index < 0) {
-            std::cerr << "Error: negative index";
+    void UnorderedList<T>::move_to_front(Node <T> &node) {
+        if (node.prev_link() == &this->sentinel()) {
+            return;
+        }
+
+        unlink(node);
+        link_front(node);
+    }
+
+    template<typename T>
+    Node <T> *UnorderedList<T>::find(const T &value) {
+        if (_index) {
+            return _index->find(value);
         }
 
+        return scan(value);
+    }
+
+    template<typename T>
+    Node <T> *UnorderedList<T>::scan(const T &value) {
         if (this->empty()) {
-            std::cerr << "Error: empty list";
+            return nullptr;
+        }
+
+        Node<T> *node = &this->first();
+        for (int32_t i = 0; i < this->size(); i++) {
+            if (node->value() == value) {
+                return node;
+            }
+
+            node = i + 1 < this->size() ? &node->next() : nullptr;
+        }
+
+        return nullptr;
+    }
+
+    template<typename T>
+    Node <T> *UnorderedList<T>::remove_value(const T &value) {
+        Node<T> *node = find(value);
+
+        if (node == nullptr) {
+            return nullptr;
+        }
+
+        // The index can find a later node than the first with the value, that
+        // replay would remove, so the position is logged instead.
+        int32_t position = -1;
+
+        if (this->_log && _index) {
+            position = 0;
+
+            for (NodeBase<T> *link = node->prev_link(); link != &this->sentinel(); link = link->prev_link()) {
+                position++;
+            }
+        }
+
+        unlink(*node);
+
+        if (this->_log && position >= 0) {
+            this->_log->record_index(LogOp::RemoveIndex, position);
+        } else if (this->_log) {
+            this->_log->record_value(LogOp::RemoveValue, value);
+        }
+
+        return node;
+    }
+
+    template<typename T>
+    int32_t UnorderedList<T>::unique() {
+        if (this->size() < 2) {
+            return 0;
+        }
+
+        const int32_t size = this->size();
+        Node<T> *kept = &this->first();
+
+        for (int32_t i = 1; i < size; i++) {
+            Node<T> &node = kept->next();
+
+            if (node.value() == kept->value()) {
+                discard(node);
+            } else {
+                kept = &node;
+            }
+        }
+
+        return size - this->size();
+    }
+
+    template<typename T>
+    int32_t UnorderedList<T>::dedup() {
+        if (this->size() < 2) {
+            return 0;
+        }
+
+        const int32_t size = this->size();
+        NodeIndex<T> seen(static_cast<size_t>(size));
+        Node<T> *node = &this->first();
+
+        for (int32_t i = 0; i < size; i++) {
+            Node<T> *next = i + 1 < size ? &node->next() : nullptr;
+
+            if (seen.insert_unique(*node) != nullptr) {
+                discard(*node);
+            }
+
+            node = next;
+        }
+
+        return size - this->size();
+    }
+
+    template<typename T>
+    template<typename Predicate>
+    int32_t UnorderedList<T>::remove_if(Predicate pred) {
+        const int32_t size = this->size();
+        Node<T> *node = this->empty() ? nullptr : &this->first();
+
+        for (int32_t i = 0; i < size; i++) {
+            Node<T> *next = i + 1 < size ? &node->next() : nullptr;
+
+            if (pred(node->value())) {
+                discard(*node);
+            }
+
+            node = next;
+        }
+
+        return size - this->size();
+    }
+
+    template<typename T>
+    template<typename Predicate>
+    UnorderedList <T> *UnorderedList<T>::extract_if(Predicate pred) {
+        auto *list = new UnorderedList<T>;
+        list->_allocated = this->_allocated;
+        list->_pool = this->_pool;
+
+        const int32_t size = this->size();
+        Node<T> *node = this->empty() ? nullptr : &this->first();
+
+        for (int32_t i = 0; i < size; i++) {
+            Node<T> *next = i + 1 < size ? &node->next() : nullptr;
+
+            if (pred(node->value())) {
+                unlink(*node);
+                list->add_back(*node);
+            }
+
+            node = next;
+        }
+
+        return list;
+    }
+
+    template<typename T>
+    template<typename Predicate>
+    int32_t UnorderedList<T>::partition(Predicate pred) {
+        const int32_t size = this->size();
+        Node<T> *node = this->empty() ? nullptr : &this->first();
+        Node<T> *rest_first = nullptr;
+        Node<T> *rest_last = nullptr;
+        int32_t moved = 0;
+
+        for (int32_t i = 0; i < size; i++) {
+            Node<T> *next = i + 1 < size ? &node->next() : nullptr;
+
+            if (!pred(node->value())) {
+                node->unlink();
+
+                if (rest_last == nullptr) {
+                    rest_first = node;
+                } else {
+                    rest_last->next(*node);
+                    node->prev(*rest_last);
+                }
+
+                rest_last = node;
+                moved++;
+            }
+
+            node = next;
+        }
+
+        if (rest_first != nullptr) {
+            this->splice(this->sentinel(), *rest_first, *rest_last);
+        }
+
+        return size - moved;
+    }
+
+    template<typename T>
+    template<typename Hash>
+    void UnorderedList<T>::enable_index() {
+        _index.reset(new NodeIndex<T, Hash>(static_cast<size_t>(this->size())));
+
+        if (this->empty()) {
+            return;
+        }
+
+        Node<T> *node = &this->first();
+        for (int32_t i = 0; i < this->size(); i++) {
+            _index->insert(*node);
+            node = i + 1 < this->size() ? &node->next() : nullptr;
         }
+    }
+
+    template<typename T>
+    void UnorderedList<T>::disable_index() {
+        _index.reset();
+    }
+
+    template<typename T>
+    bool UnorderedList<T>::indexed() const {
+        return _index != nullptr;
+    }
+
+    template<typename T>
+    size_t UnorderedList<T>::index_memory() const {
+        return _index ? _index->memory() : 0;
+    }
+
+    template<typename T>
+    void UnorderedList<T>::sort() {
+        if (this->size() < 2) {
+            return;
+        }
+
+        Node<T> *first;
+        Node<T> *last;
+        this->release(first, last);
+
+        DefaultSort<T>::sort(first, last);
+
+        this->splice(this->sentinel(), *first, *last);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void UnorderedList<T>::sort(Compare comp) {
+        if (this->size() < 2) {
+            return;
+        }
+
+        Node<T> *first;
+        Node<T> *last;
+        this->release(first, last);
+
+        ListSort<T>::merge_sort(first, last, comp);
+
+        this->splice(this->sentinel(), *first, *last);
+    }
+
+    template<typename T>
+    void UnorderedList<T>::parallel_sort(ThreadPool &pool) {
+        parallel_sort_aux(pool, [](Node<T> *&first, Node<T> *&last) {
+            DefaultSort<T>::sort(first, last);
+        }, std::less<T>());
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void UnorderedList<T>::parallel_sort(ThreadPool &pool, Compare comp) {
+        parallel_sort_aux(pool, [comp](Node<T> *&first, Node<T> *&last) {
+            ListSort<T>::merge_sort(first, last, comp);
+        }, comp);
+    }
+
+    template<typename T>
+    template<typename SortChunk, typename Compare>
+    void UnorderedList<T>::parallel_sort_aux(ThreadPool &pool, SortChunk sort_chunk, Compare comp) {
+        const auto count = static_cast<size_t>(this->size());
+        if (count < 2) {
+            return;
+        }
+
+        Node<T> *first;
+        Node<T> *last;
+        this->release(first, last);
+
+        std::vector<Node<T> *> firsts;
+        std::vector<Node<T> *> lasts;
+        ListSort<T>::split(first, count, std::min(pool.size(), count), firsts, lasts);
+
+        std::vector<std::future<void>> sorts;
+        sorts.reserve(firsts.size());
 
-        if (index > this->size()) {
-            std::cerr << "Error: index out of range";
+        for (size_t i = 0; i < firsts.size(); i++) {
+            sorts.push_back(pool.submit([&firsts, &lasts, sort_chunk, i] {
+                sort_chunk(firsts[i], lasts[i]);
+            }));
         }
 
-        return remove_aux(index, List<T>::first());
+        for (auto &sort : sorts) {
+            sort.get();
+        }
+
+        ListSort<T>::parallel_merge(pool, firsts, lasts, comp);
+
+        this->splice(this->sentinel(), *firsts[0], *lasts[0]);
     }
 
     template<typename T>
@@ -158,25 +631,54 @@ namespace simple_list {
             return remove_aux(index - 1, node.next());
         }
 
-        if (node.has_next()) {
-            auto &next = node.next();
-            auto &prev = node.prev();
+        unlink(node);
 
-            prev.next(next);
-            next.prev(prev);
-        } else {
-            if (node.has_prev()) {
-                node.prev().clear_next();
-                this->tail().set(node.prev());
-            } else {
-                this->_head = this->_tail;
-            }
+        return node;
+    }
+
+    template<typename T>
+    void UnorderedList<T>::unlink(Node <T> &node) {
+        node.unlink();
+        this->_version++;
+
+        if (_index) {
+            _index->erase(node);
         }
 
-        node.clear();
         this->_size--;
+    }
 
-        return node;
+    template<typename T>
+    void UnorderedList<T>::index_chain(Node <T> &first, Node <T> &last) {
+        if (!_index) {
+            return;
+        }
+
+        Node<T> *node = &first;
+        _index->insert(*node);
+
+        while (node != &last) {
+            node = &node->next();
+            _index->insert(*node);
+        }
+    }
+
+    template<typename T>
+    void UnorderedList<T>::link_front(Node <T> &node) {
+        node.link(this->sentinel(), *this->sentinel().next_link());
+        this->_version++;
+
+        if (_index) {
+            _index->insert(node);
+        }
+
+        this->_size++;
+    }
+
+    template<typename T>
+    void UnorderedList<T>::discard(Node <T> &node) {
+        unlink(node);
+        this->dispose(node);
     }
 
 } // namespace simple_list
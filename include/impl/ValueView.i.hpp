@@ -0,0 +1,66 @@
+/**
+ * @copyright Copyright 2018 SimpleList
+ *
+ * <blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>
+ *
+ * @author Enrico Pasquali                                                  <br>
+ *         Univerity of Verona, Dept. of Computer Science                   <br>
+ *         enrico.pasquali@studenti.univr.it
+ * @date June, 2018
+ * @version v0.1
+ *
+ * @file
+ */
+
+#pragma once
+
+namespace simple_list {
+
+    template<typename T, typename V>
+    ValueView<T, V>::ValueView(NodeType *first, size_t size, iterator end)
+            : _first(first), _size(size), _end(end) {
+    }
+
+    template<typename T, typename V>
+    size_t ValueView<T, V>::size() const { return _size; }
+
+    template<typename T, typename V>
+    bool ValueView<T, V>::empty() const { return _size == 0; }
+
+    template<typename T, typename V>
+    V &ValueView<T, V>::operator[](size_t i) const {
+        return _first[i].value();
+    }
+
+    template<typename T, typename V>
+    constexpr size_t ValueView<T, V>::stride() { return sizeof(Node<T>); }
+
+    template<typename T, typename V>
+    typename ValueView<T, V>::iterator ValueView<T, V>::begin() const {
+        return _size == 0 ? _end : iterator(_first);
+    }
+
+    template<typename T, typename V>
+    typename ValueView<T, V>::iterator ValueView<T, V>::end() const {
+        return _end;
+    }
+
+} // namespace simple_list
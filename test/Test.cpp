@@ -26,9 +26,34 @@
  * @file
  */
 
+#include "../include/LruCache.hpp"
+#include "../include/MappedList.hpp"
+#include "../include/MutationLog.hpp"
+#include "../include/IntrusiveOrderedList.hpp"
+#include "../include/IntrusiveUnorderedList.hpp"
+#include "../include/BlockKernels.hpp"
+#include "../include/ListBase.hpp"
+#include "../include/NodeIndex.hpp"
+#include "../include/NodePool.hpp"
 #include "../include/OrderedList.hpp"
+#include "../include/SharedList.hpp"
+#include "../include/ThreadPool.hpp"
 #include "../include/UnorderedList.hpp"
 #include "Node.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <sys/wait.h>
+#include <type_traits>
+#include <unistd.h>
+#include <vector>
 
 #define CATCH_CONFIG_MAIN
 
@@ -36,11 +61,65 @@
 
 #undef CATCH_CONFIG_MAIN
 
+struct ByAge {
+};
+
+struct Person : sl::ListHook<>, sl::ListHook<ByAge> {
+    Person(std::string n, int a) : name(std::move(n)), age(a) {}
+
+    std::string name;
+    int age;
+    sl::ListHook<> hook;
+};
+
+struct PersonAge {
+    bool operator()(const Person &a, const Person &b) const { return a.age < b.age; }
+};
+
+using PersonNameHook = sl::MemberHook<Person, sl::ListHook<>, &Person::hook>;
+
+struct Record {
+    int32_t key;
+    char payload[196];
+
+    bool operator<(const Record &other) const { return key < other.key; }
+};
+
+struct Point {
+    int32_t x;
+    int32_t y;
+};
+
 template<typename T>
 void mul(sl::Node<T> &n) {
     n.value(n.value() * 2);
 }
 
+template<typename Derived, typename T>
+T drain(sl::ListBase<Derived, T> &list) {
+    T sum{};
+
+    while (!list.empty()) {
+        sum += list.pop_front().value();
+    }
+
+    return sum;
+}
+
+/**
+ * @brief A list that counts the calls of add, to tell the static interface from
+ * the virtual one.
+ */
+class CountingAddList : public sl::UnorderedList<int> {
+public:
+    int adds{0};
+
+    void add(sl::Node<int> &node) override {
+        adds++;
+        sl::UnorderedList<int>::add(node);
+    }
+};
+
 TEST_CASE("Node ctors", "[node_ctor]") {
     using T = int;
 
@@ -314,9 +393,13 @@ TEST_CASE("UnorderedList remove", "[ul_remove]") {
     list.add_back(n2);
     list.add_back(n3);
 
-    auto &r3 = list.remove(2);
-    auto &r2 = list.remove(1);
-    auto &r1 = list.remove(0);
+    REQUIRE(list.remove(3) == nullptr);
+    REQUIRE(list.remove(-1) == nullptr);
+    REQUIRE(list.size() == 3);
+
+    auto &r3 = *list.remove(2);
+    auto &r2 = *list.remove(1);
+    auto &r1 = *list.remove(0);
 
     REQUIRE(r3 == n3);
     REQUIRE(r2 == n2);
@@ -341,7 +424,7 @@ TEST_CASE("List apply", "[l_apply]") {
     list.add_back(n2);
     list.add_back(n3);
 
-    list.apply(mul);
+    list.apply(mul<T>);
 
     REQUIRE(n1.value() == 2);
     REQUIRE(n2.value() == 4);
@@ -508,3 +591,1992 @@ TEST_CASE("UnorderedList create_from_array", "[ul_create_from_array]") {
 
     delete list;
 }
+
+TEST_CASE("UnorderedList sort", "[ul_sort]") {
+    using T = int;
+
+    sl::Node<T> n1(3);
+    sl::Node<T> n2(1);
+    sl::Node<T> n3(2);
+    sl::Node<T> n4(1);
+    sl::UnorderedList<T> list;
+
+    list.sort();
+
+    REQUIRE(list.empty());
+
+    list.add_back(n1);
+    list.add_back(n2);
+    list.add_back(n3);
+    list.add_back(n4);
+
+    list.sort();
+
+    REQUIRE(list.first() == n2);
+    REQUIRE(list.first().next() == n4);
+    REQUIRE(list.first().next().next() == n3);
+    REQUIRE(list.last() == n1);
+    REQUIRE(list.last().prev() == n3);
+    REQUIRE(list.last().prev().prev() == n4);
+    REQUIRE(list.last().prev().prev().prev() == n2);
+    REQUIRE(list.size() == 4);
+
+    list.sort([](T a, T b) { return a > b; });
+
+    REQUIRE(list.first() == n1);
+    REQUIRE(list.first().next() == n3);
+    REQUIRE(list.first().next().next() == n2);
+    REQUIRE(list.last() == n4);
+
+    const size_t ksize = 1000;
+    T array[ksize];
+    for (size_t i = 0; i < ksize; i++) {
+        array[i] = static_cast<T>((i * 7919) % 101);
+    }
+
+    auto *big = sl::UnorderedList<T>::create_from_array(array, ksize);
+
+    big->sort();
+
+    auto *node = &big->first();
+    for (size_t i = 1; i < ksize; i++) {
+        REQUIRE(node->value() <= node->next().value());
+        REQUIRE(node->next().prev() == *node);
+        node = &node->next();
+    }
+
+    REQUIRE(*node == big->last());
+    REQUIRE(big->size() == static_cast<int32_t>(ksize));
+
+    // The merge sort keeps the previous links and the last node while merging.
+    big->sort([](T a, T b) { return a % 7 < b % 7; });
+
+    node = &big->first();
+    for (size_t i = 1; i < ksize; i++) {
+        REQUIRE(node->value() % 7 <= node->next().value() % 7);
+        REQUIRE(node->next().prev() == *node);
+        node = &node->next();
+    }
+
+    REQUIRE(*node == big->last());
+
+    delete big;
+}
+
+TEST_CASE("UnorderedList radix sort", "[ul_radix_sort]") {
+    const size_t ksize = 1000;
+    int32_t ints[ksize];
+    double doubles[ksize];
+    uint8_t bytes[ksize];
+
+    for (size_t i = 0; i < ksize; i++) {
+        ints[i] = static_cast<int32_t>((i * 7919) % 2003) - 1000;
+        doubles[i] = static_cast<double>(ints[i]) / 3.0;
+        bytes[i] = static_cast<uint8_t>(i % 7);
+    }
+
+    doubles[0] = -0.0;
+    doubles[1] = 1e300;
+    doubles[2] = -1e300;
+
+    auto *ilist = sl::UnorderedList<int32_t>::create_from_array(ints, ksize);
+    auto *dlist = sl::UnorderedList<double>::create_from_array(doubles, ksize);
+    auto *blist = sl::UnorderedList<uint8_t>::create_from_array(bytes, ksize);
+
+    ilist->sort();
+    dlist->sort();
+    blist->sort();
+
+    std::sort(ints, ints + ksize);
+    std::sort(doubles, doubles + ksize);
+    std::sort(bytes, bytes + ksize);
+
+    auto *inode = &ilist->first();
+    auto *dnode = &dlist->first();
+    auto *bnode = &blist->first();
+    for (size_t i = 0; i < ksize; i++) {
+        REQUIRE(inode->value() == ints[i]);
+        REQUIRE(!(dnode->value() < doubles[i]));
+        REQUIRE(!(dnode->value() > doubles[i]));
+        REQUIRE(bnode->value() == bytes[i]);
+
+        if (i + 1 < ksize) {
+            REQUIRE(inode->next().prev() == *inode);
+            inode = &inode->next();
+            dnode = &dnode->next();
+            bnode = &bnode->next();
+        }
+    }
+
+    REQUIRE(*inode == ilist->last());
+    REQUIRE(*dnode == dlist->last());
+    REQUIRE(*bnode == blist->last());
+
+    delete ilist;
+    delete dlist;
+    delete blist;
+}
+
+TEST_CASE("OrderedList create_from_array", "[ol_create_from_array]") {
+    using T = int;
+
+    const size_t ksize = 5;
+    T array[ksize] = {3, -1, 4, 1, 5};
+
+    auto *list = sl::OrderedList<T>::create_from_array(array, ksize);
+
+    REQUIRE(list->size() == 5);
+    REQUIRE(list->first().value() == -1);
+    REQUIRE(list->first().next().value() == 1);
+    REQUIRE(list->first().next().next().value() == 3);
+    REQUIRE(list->last().value() == 5);
+    REQUIRE(list->last().prev().value() == 4);
+
+    auto &node = list->remove_front();
+    delete &node;
+
+    REQUIRE(list->first().value() == 1);
+
+    auto *empty = sl::OrderedList<T>::create_from_array(array, 0);
+
+    REQUIRE(empty->empty());
+
+    delete list;
+    delete empty;
+}
+
+TEST_CASE("UnorderedList parallel_sort", "[ul_parallel_sort]") {
+    using T = int;
+
+    const size_t ksize = 1001;
+    T array[ksize];
+    std::vector<sl::Node<T>> nodes;
+
+    for (size_t i = 0; i < ksize; i++) {
+        array[i] = static_cast<T>((i * 7919) % 101) - 50;
+        nodes.emplace_back(array[i] / 2);
+    }
+
+    sl::ThreadPool pool(4);
+    auto *list = sl::UnorderedList<T>::create_from_array(array, ksize);
+    sl::UnorderedList<T> pairs;
+
+    for (auto &node : nodes) {
+        pairs.add_back(node);
+    }
+
+    list->parallel_sort(pool);
+    pairs.parallel_sort(pool, [](T a, T b) { return a > b; });
+
+    std::sort(array, array + ksize);
+
+    auto *node = &list->first();
+    auto *pair = &pairs.first();
+    for (size_t i = 0; i < ksize; i++) {
+        REQUIRE(node->value() == array[i]);
+
+        if (i + 1 < ksize) {
+            REQUIRE(node->next().prev() == *node);
+            REQUIRE(pair->value() >= pair->next().value());
+
+            // Stable: nodes with the same value keep the insertion order.
+            if (pair->value() == pair->next().value()) {
+                REQUIRE(pair < &pair->next());
+            }
+
+            node = &node->next();
+            pair = &pair->next();
+        }
+    }
+
+    REQUIRE(*node == list->last());
+    REQUIRE(*pair == pairs.last());
+    REQUIRE(list->size() == static_cast<int32_t>(ksize));
+
+    delete list;
+}
+
+TEST_CASE("OrderedList parallel create_from_array", "[ol_parallel_create_from_array]") {
+    using T = double;
+
+    const size_t ksize = 999;
+    T array[ksize];
+
+    for (size_t i = 0; i < ksize; i++) {
+        array[i] = static_cast<T>((i * 7919) % 1009) / 7.0 - 20.0;
+    }
+
+    sl::ThreadPool pool(3);
+    auto *list = sl::OrderedList<T>::create_from_array(array, ksize, pool);
+
+    std::sort(array, array + ksize);
+
+    auto *node = &list->first();
+    for (size_t i = 0; i < ksize; i++) {
+        REQUIRE(!(node->value() < array[i]));
+        REQUIRE(!(node->value() > array[i]));
+
+        if (i + 1 < ksize) {
+            REQUIRE(node->next().prev() == *node);
+            node = &node->next();
+        }
+    }
+
+    REQUIRE(*node == list->last());
+    REQUIRE(list->size() == static_cast<int32_t>(ksize));
+
+    delete list;
+}
+
+TEST_CASE("UnorderedList index", "[ul_index]") {
+    using T = int;
+
+    sl::Node<T> n1(1);
+    sl::Node<T> n2(2);
+    sl::Node<T> n3(3);
+    sl::Node<T> n4(2);
+    sl::UnorderedList<T> list;
+
+    list.add_back(n1);
+    list.add_back(n2);
+
+    REQUIRE(!list.indexed());
+    REQUIRE(list.index_memory() == 0);
+    REQUIRE(list.find(2) == &n2);
+    REQUIRE(list.find(5) == nullptr);
+
+    list.enable_index();
+    list.add_front(n3);
+    list.add_back(n4);
+
+    REQUIRE(list.indexed());
+    REQUIRE(list.index_memory() > 0);
+    REQUIRE(list.find(3) == &n3);
+    REQUIRE(list.find(1) == &n1);
+    REQUIRE(list.find(5) == nullptr);
+
+    auto *r1 = list.remove_value(1);
+
+    REQUIRE(r1 == &n1);
+    REQUIRE(list.find(1) == nullptr);
+    REQUIRE(list.first() == n3);
+    REQUIRE(list.first().next() == n2);
+    REQUIRE(list.size() == 3);
+
+    auto *r2 = list.remove_value(2);
+    auto *r3 = list.remove_value(2);
+
+    REQUIRE(r2 != r3);
+    REQUIRE((r2 == &n2 || r2 == &n4));
+    REQUIRE((r3 == &n2 || r3 == &n4));
+    REQUIRE(list.find(2) == nullptr);
+    REQUIRE(list.remove_value(2) == nullptr);
+    REQUIRE(list.first() == n3);
+    REQUIRE(list.last() == n3);
+
+    list.remove_front();
+
+    REQUIRE(list.empty());
+    REQUIRE(list.find(3) == nullptr);
+
+    list.add_back(n1);
+    list.add_back(n2);
+    list.remove(0);
+
+    REQUIRE(list.find(1) == nullptr);
+    REQUIRE(list.find(2) == &n2);
+    REQUIRE(list.first() == n2);
+
+    list.disable_index();
+
+    REQUIRE(list.find(2) == &n2);
+    REQUIRE(list.index_memory() == 0);
+}
+
+TEST_CASE("NodeIndex", "[node_index]") {
+    using T = int;
+
+    const size_t ksize = 1000;
+    std::vector<sl::Node<T>> nodes;
+    sl::NodeIndex<T> index;
+
+    for (size_t i = 0; i < ksize; i++) {
+        nodes.emplace_back(static_cast<T>(i % 500));
+    }
+
+    for (auto &node : nodes) {
+        index.insert(node);
+    }
+
+    REQUIRE(index.size() == ksize);
+
+    for (size_t i = 0; i < ksize; i += 2) {
+        REQUIRE(index.erase(nodes[i]));
+    }
+
+    REQUIRE(!index.erase(nodes[0]));
+    REQUIRE(index.size() == ksize / 2);
+
+    for (size_t i = 1; i < ksize; i += 2) {
+        REQUIRE(index.find(nodes[i].value()) != nullptr);
+        REQUIRE(index.insert_unique(nodes[i]) != nullptr);
+    }
+
+    REQUIRE(index.find(500) == nullptr);
+    REQUIRE(index.find(0) == nullptr);
+}
+
+TEST_CASE("UnorderedList unique", "[ul_unique]") {
+    using T = int;
+
+    sl::Node<T> n1(1);
+    sl::Node<T> n2(1);
+    sl::Node<T> n3(2);
+    sl::Node<T> n4(1);
+    sl::Node<T> n5(1);
+    sl::UnorderedList<T> list;
+
+    list.add_back(n1);
+    list.add_back(n2);
+    list.add_back(n3);
+    list.add_back(n4);
+    list.add_back(n5);
+
+    REQUIRE(list.unique() == 2);
+    REQUIRE(list.size() == 3);
+    REQUIRE(list.first() == n1);
+    REQUIRE(list.first().next() == n3);
+    REQUIRE(list.last() == n4);
+    REQUIRE(list.last().prev() == n3);
+    REQUIRE(list.unique() == 0);
+
+    const size_t ksize = 8;
+    T array[ksize] = {4, 4, 4, 4, 3, 3, 4, 4};
+
+    auto *owned = sl::UnorderedList<T>::create_from_array(array, ksize);
+
+    REQUIRE(owned->unique() == 5);
+    REQUIRE(owned->size() == 3);
+    REQUIRE(owned->first().value() == 4);
+    REQUIRE(owned->first().next().value() == 3);
+    REQUIRE(owned->last().value() == 4);
+
+    delete owned;
+}
+
+TEST_CASE("UnorderedList dedup", "[ul_dedup]") {
+    using T = int;
+
+    sl::Node<T> n1(1);
+    sl::Node<T> n2(2);
+    sl::Node<T> n3(1);
+    sl::Node<T> n4(3);
+    sl::Node<T> n5(2);
+    sl::UnorderedList<T> list;
+
+    list.add_back(n1);
+    list.add_back(n2);
+    list.add_back(n3);
+    list.add_back(n4);
+    list.add_back(n5);
+    list.enable_index();
+
+    REQUIRE(list.dedup() == 2);
+    REQUIRE(list.size() == 3);
+    REQUIRE(list.first() == n1);
+    REQUIRE(list.first().next() == n2);
+    REQUIRE(list.last() == n4);
+    REQUIRE(list.last().prev() == n2);
+    REQUIRE(list.find(2) == &n2);
+
+    const size_t ksize = 1000;
+    T array[ksize];
+    for (size_t i = 0; i < ksize; i++) {
+        array[i] = static_cast<T>((i * 7919) % 101);
+    }
+
+    auto *owned = sl::UnorderedList<T>::create_from_array(array, ksize);
+
+    REQUIRE(owned->dedup() == static_cast<int32_t>(ksize) - 101);
+    REQUIRE(owned->size() == 101);
+
+    owned->sort();
+
+    REQUIRE(owned->first().value() == 0);
+    REQUIRE(owned->last().value() == 100);
+
+    delete owned;
+}
+
+TEST_CASE("UnorderedList remove node", "[ul_remove_node]") {
+    using T = int;
+
+    sl::Node<T> n1(1);
+    sl::Node<T> n2(2);
+    sl::Node<T> n3(3);
+    sl::UnorderedList<T> list;
+
+    list.add_back(n1);
+    list.add_back(n2);
+    list.add_back(n3);
+
+    list.move_to_front(n3);
+
+    REQUIRE(list.first() == n3);
+    REQUIRE(list.first().next() == n1);
+    REQUIRE(list.last() == n2);
+
+    list.move_to_front(n3);
+
+    REQUIRE(list.first() == n3);
+    REQUIRE(list.size() == 3);
+
+    auto &r1 = list.remove(n1);
+
+    REQUIRE(r1 == n1);
+    REQUIRE(list.first().next() == n2);
+    REQUIRE(list.last().prev() == n3);
+
+    list.remove(n2);
+    list.remove(n3);
+
+    REQUIRE(list.empty());
+}
+
+TEST_CASE("LruCache", "[lru_cache]") {
+    sl::LruCache<int, std::string> cache(2);
+    std::string value;
+
+    REQUIRE(!cache.get(1, value));
+
+    cache.put(1, "one");
+    cache.put(2, "two");
+
+    REQUIRE(cache.get(1, value));
+    REQUIRE(value == "one");
+
+    cache.put(3, "three");
+
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.evictions() == 1);
+    REQUIRE(!cache.get(2, value));
+    REQUIRE(cache.get(3, value));
+    REQUIRE(value == "three");
+
+    cache.put(1, "uno");
+    cache.put(4, "four");
+
+    REQUIRE(cache.get(1, value));
+    REQUIRE(value == "uno");
+    REQUIRE(!cache.get(3, value));
+    REQUIRE(cache.hits() == 3);
+    REQUIRE(cache.misses() == 3);
+    REQUIRE(cache.capacity() == 2);
+}
+
+TEST_CASE("UnorderedList remove_if", "[ul_remove_if]") {
+    using T = int;
+
+    const size_t ksize = 10;
+    T array[ksize] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    auto *list = sl::UnorderedList<T>::create_from_array(array, ksize);
+
+    REQUIRE(list->remove_if([](T value) { return value % 3 == 0; }) == 4);
+    REQUIRE(list->size() == 6);
+    REQUIRE(list->first().value() == 1);
+    REQUIRE(list->first().next().value() == 2);
+    REQUIRE(list->first().next().next().value() == 4);
+    REQUIRE(list->last().value() == 8);
+    REQUIRE(list->last().prev().value() == 7);
+
+    REQUIRE(list->remove_if([](T value) { return value > 0; }) == 6);
+    REQUIRE(list->empty());
+
+    delete list;
+}
+
+TEST_CASE("UnorderedList extract_if", "[ul_extract_if]") {
+    using T = int;
+
+    sl::Node<T> n1(1);
+    sl::Node<T> n2(2);
+    sl::Node<T> n3(3);
+    sl::Node<T> n4(4);
+    sl::UnorderedList<T> list;
+
+    list.add_back(n1);
+    list.add_back(n2);
+    list.add_back(n3);
+    list.add_back(n4);
+
+    auto *even = list.extract_if([](T value) { return value % 2 == 0; });
+
+    REQUIRE(even->size() == 2);
+    REQUIRE(even->first() == n2);
+    REQUIRE(even->last() == n4);
+    REQUIRE(list.size() == 2);
+    REQUIRE(list.first() == n1);
+    REQUIRE(list.first().next() == n3);
+    REQUIRE(list.last() == n3);
+
+    delete even;
+}
+
+TEST_CASE("UnorderedList partition", "[ul_partition]") {
+    using T = int;
+
+    sl::Node<T> n1(1);
+    sl::Node<T> n2(2);
+    sl::Node<T> n3(3);
+    sl::Node<T> n4(4);
+    sl::Node<T> n5(5);
+    sl::UnorderedList<T> list;
+
+    list.add_back(n1);
+    list.add_back(n2);
+    list.add_back(n3);
+    list.add_back(n4);
+    list.add_back(n5);
+
+    REQUIRE(list.partition([](T value) { return value % 2 == 0; }) == 2);
+    REQUIRE(list.size() == 5);
+    REQUIRE(list.first() == n2);
+    REQUIRE(list.first().next() == n4);
+    REQUIRE(list.first().next().next() == n1);
+    REQUIRE(list.last() == n5);
+    REQUIRE(list.last().prev() == n3);
+    REQUIRE(list.last().prev().prev() == n1);
+    REQUIRE(list.last().prev().prev().prev() == n4);
+
+    REQUIRE(list.partition([](T value) { return value > 5; }) == 0);
+    REQUIRE(list.first() == n2);
+    REQUIRE(list.last() == n5);
+    REQUIRE(list.last().prev().prev().prev().prev() == n2);
+}
+
+TEST_CASE("UnorderedList add chain", "[ul_add_chain]") {
+    using T = int;
+
+    sl::Node<T> n1(1);
+    sl::Node<T> n2(2);
+    sl::Node<T> n3(3);
+    sl::Node<T> n4(4);
+    sl::Node<T> n5(5);
+    sl::UnorderedList<T> list;
+
+    n2.next(n3);
+    n3.prev(n2);
+
+    list.add_back_chain(n2, n3, 2);
+
+    REQUIRE(list.size() == 2);
+    REQUIRE(list.first() == n2);
+    REQUIRE(list.last() == n3);
+
+    list.enable_index();
+    list.add_front_chain(n1, n1, 1);
+
+    n4.next(n5);
+    n5.prev(n4);
+
+    list.add_back_chain(n4, n5, 2);
+
+    REQUIRE(list.size() == 5);
+    REQUIRE(list.first() == n1);
+    REQUIRE(list.first().next() == n2);
+    REQUIRE(list.first().next().next().next() == n4);
+    REQUIRE(list.last() == n5);
+    REQUIRE(list.last().prev().prev() == n3);
+    REQUIRE(list.last().prev().prev().prev().prev() == n1);
+    REQUIRE(list.find(5) == &n5);
+    REQUIRE(list.find(1) == &n1);
+
+    list.remove_value(1);
+    list.remove_value(5);
+
+    REQUIRE(list.first() == n2);
+    REQUIRE(list.last() == n4);
+}
+
+TEST_CASE("Node size", "[node_size]") {
+    REQUIRE(sizeof(sl::Node<int64_t>) == 2 * sizeof(void *) + sizeof(int64_t));
+    REQUIRE(sizeof(sl::Node<char>) <= 2 * sizeof(void *) + alignof(void *));
+    REQUIRE(sizeof(sl::SentinelNode<std::string>) == sizeof(sl::SentinelNode<char>));
+    REQUIRE(sizeof(sl::SentinelNode<char>) <= 2 * sizeof(void *) + alignof(void *));
+}
+
+TEST_CASE("List ring", "[l_ring]") {
+    sl::UnorderedList<int> list;
+    sl::Node<int> n1{1};
+    sl::Node<int> n2{2};
+    sl::Node<int> n3{3};
+
+    list.add_back(n2);
+    REQUIRE(n2.next_link() == n2.prev_link());
+
+    list.add_front(n1);
+    list.add_back(n3);
+    REQUIRE(n3.next_link() == n1.prev_link());
+    REQUIRE(n3.next_link()->next_link() == &n1);
+    REQUIRE(n1.prev_link()->prev_link() == &n3);
+
+    list.remove(n2);
+    REQUIRE_FALSE(n2.has_next());
+    REQUIRE_FALSE(n2.has_prev());
+    REQUIRE(n1.next() == n3);
+    REQUIRE(n3.prev() == n1);
+
+    list.remove_front();
+    list.remove_back();
+    REQUIRE(list.empty());
+
+    list.add_front(n3);
+    REQUIRE(list.first() == n3);
+    REQUIRE(list.last() == n3);
+
+    sl::OrderedList<int> ordered;
+    ordered.add(n2);
+    ordered.add(n1);
+    REQUIRE(ordered.remove_value(5) == nullptr);
+    REQUIRE(ordered.remove_value(1) == &n1);
+    REQUIRE(ordered.remove_front() == n2);
+    REQUIRE(ordered.empty());
+}
+
+TEST_CASE("Node value by reference", "[node_value_ref]") {
+    sl::Node<std::string> n1(std::string(64, 'a'));
+    const sl::Node<std::string> &c1 = n1;
+
+    n1.value().push_back('b');
+    REQUIRE(c1.value().size() == 65);
+    REQUIRE(&c1.value() == &n1.value());
+
+    std::string value(64, 'c');
+    n1.value(std::move(value));
+    REQUIRE(n1.value() == std::string(64, 'c'));
+
+    sl::Node<std::unique_ptr<int>> n2(std::unique_ptr<int>(new int(1)));
+    n2.value(std::unique_ptr<int>(new int(2)));
+    REQUIRE(*n2.value() == 2);
+
+    sl::Node<std::string> n3(sl::InPlace(), 3, 'x');
+    REQUIRE(n3.value() == "xxx");
+}
+
+TEST_CASE("NodePool", "[node_pool]") {
+    sl::NodePool<std::string> pool(2);
+    sl::Node<std::string> outside;
+
+    auto *n1 = pool.create(3, 'a');
+    auto *n2 = pool.create("b");
+    auto *n3 = pool.create();
+
+    REQUIRE(pool.size() == 3);
+    REQUIRE(pool.capacity() == 4);
+    REQUIRE(pool.owns(n1));
+    REQUIRE(pool.owns(n3));
+    REQUIRE_FALSE(pool.owns(&outside));
+    REQUIRE(n1->value() == "aaa");
+    REQUIRE(n2->value() == "b");
+    REQUIRE(n3->value().empty());
+    REQUIRE_FALSE(n1->has_next());
+
+    pool.destroy(n2);
+    REQUIRE(pool.size() == 2);
+    REQUIRE(pool.create(std::string(100, 'c')) == n2);
+    REQUIRE(pool.capacity() == 4);
+
+    // The nodes still alive are destroyed with the pool.
+    pool.create(std::string(100, 'd'));
+    pool.create(std::string(100, 'e'));
+    REQUIRE(pool.size() == 5);
+    REQUIRE(pool.capacity() == 8);
+}
+
+TEST_CASE("UnorderedList emplace", "[ul_emplace]") {
+    sl::UnorderedList<std::unique_ptr<int>> list;
+
+    auto &n2 = list.emplace_back(new int(2));
+    auto &n1 = list.emplace_front(new int(1));
+    auto &n3 = list.emplace(new int(3));
+    list.emplace_back(new int(4));
+
+    REQUIRE(list.size() == 4);
+    REQUIRE(&list.first() == &n1);
+    REQUIRE(&n1.next() == &n2);
+    REQUIRE(&n2.next() == &n3);
+    REQUIRE(*list.last().value() == 4);
+
+    *n2.value() = 20;
+    REQUIRE(list.remove_if([](const std::unique_ptr<int> &v) { return *v % 2 == 0; }) == 2);
+    REQUIRE(list.size() == 2);
+    REQUIRE(&list.last() == &n3);
+
+    // The slots of the removed nodes are reused.
+    auto &n5 = list.emplace_back(new int(5));
+    REQUIRE((&n5 == &n3 - 1 || &n5 == &n3 + 1));
+
+    sl::Node<std::unique_ptr<int>> outside(std::unique_ptr<int>(new int(6)));
+    list.add_back(outside);
+
+    auto *odd = list.extract_if([](const std::unique_ptr<int> &v) { return *v != 6; });
+    REQUIRE(odd->size() == 3);
+    REQUIRE(&list.first() == &outside);
+    list.remove(outside);
+    delete odd;
+
+    sl::UnorderedList<std::string> strings;
+    strings.emplace_back(2, 'b');
+    strings.emplace_back("a");
+    strings.sort();
+    REQUIRE(strings.first().value() == "a");
+    REQUIRE(strings.remove_value("bb") == &strings.last());
+}
+
+TEST_CASE("OrderedList emplace", "[ol_emplace]") {
+    sl::OrderedList<std::string> list;
+
+    list.emplace("c");
+    auto &a = list.emplace(1, 'a');
+    list.emplace("b");
+    list.emplace("b");
+
+    REQUIRE(list.size() == 4);
+    REQUIRE(list.first() == a);
+    REQUIRE(list.first().next().value() == "b");
+    REQUIRE(list.last().value() == "c");
+    REQUIRE(list.remove_value("b") != nullptr);
+    REQUIRE(list.size() == 3);
+}
+
+TEST_CASE("IntrusiveUnorderedList", "[il_unordered]") {
+    Person p1{"a", 30};
+    Person p2{"b", 20};
+    Person p3{"c", 10};
+
+    sl::IntrusiveUnorderedList<Person> list;
+    sl::IntrusiveUnorderedList<Person, PersonNameHook> names;
+
+    list.add_back(p2);
+    list.add_front(p1);
+    list.add(p3);
+    names.add(p3);
+    names.add(p1);
+
+    REQUIRE(list.size() == 3);
+    REQUIRE(&list.first() == &p1);
+    REQUIRE(&list.last() == &p3);
+    REQUIRE(&names.first() == &p3);
+    REQUIRE(&names.last() == &p1);
+    REQUIRE_FALSE(decltype(names)::linked(p2));
+
+    // A hook can't be in two lists at once.
+    list.add(p1);
+    REQUIRE(list.size() == 3);
+
+    list.remove(p1);
+    REQUIRE(&list.first() == &p2);
+    REQUIRE(&names.last() == &p1);
+
+    list.move_to_front(p3);
+    REQUIRE(&list.first() == &p3);
+    REQUIRE(&list.remove_back() == &p2);
+
+    int sum = 0;
+    names.apply([&sum](Person &p) { sum += p.age; });
+    REQUIRE(sum == 40);
+
+    list.remove_front();
+    REQUIRE(list.empty());
+    REQUIRE_FALSE(decltype(list)::linked(p3));
+    REQUIRE(decltype(names)::linked(p3));
+
+    // A copy is not in the lists of the original.
+    Person copy = p1;
+    REQUIRE_FALSE(decltype(names)::linked(copy));
+}
+
+TEST_CASE("IntrusiveOrderedList", "[il_ordered]") {
+    std::vector<Person> people{{"d", 40}, {"b", 20}, {"c", 20}, {"a", 10}};
+
+    sl::IntrusiveOrderedList<Person, sl::BaseHook<Person, ByAge>, PersonAge> by_age;
+    sl::IntrusiveUnorderedList<Person> all;
+
+    {
+        sl::IntrusiveOrderedList<Person, PersonNameHook, PersonAge> names;
+
+        for (auto &p : people) {
+            by_age.add(p);
+            all.add(p);
+            names.add(p);
+        }
+
+        REQUIRE(names.size() == 4);
+    }
+
+    REQUIRE(decltype(all)::linked(people[0]));
+    REQUIRE_FALSE(sl::IntrusiveList<Person, PersonNameHook>::linked(people[0]));
+    REQUIRE(by_age.size() == 4);
+
+    std::string order;
+    by_age.apply([&order](Person &p) { order += p.name; });
+    REQUIRE(order == "abcd");
+
+    by_age.remove(people[1]);
+    REQUIRE(&by_age.first().hook == &people[3].hook);
+    REQUIRE(by_age.first().age == 10);
+    REQUIRE(by_age.last().name == "d");
+    REQUIRE(all.size() == 4);
+}
+
+struct Job : sl::ListHook<sl::DefaultHookTag, sl::Throwing> {
+    int id;
+};
+
+TEST_CASE("Intrusive list check policy", "[il_check]") {
+    using JobHook = sl::BaseHook<Job, sl::DefaultHookTag, sl::Throwing>;
+    Job j1{};
+    Job j2{};
+
+    sl::IntrusiveUnorderedList<Job, JobHook> first;
+    sl::IntrusiveUnorderedList<Job, JobHook> second;
+    first.add(j1);
+    second.add(j2);
+
+    // An object of another list is not removed from this one.
+    REQUIRE_THROWS_AS(first.remove(j2), std::logic_error);
+    REQUIRE(first.size() == 1);
+    REQUIRE(second.size() == 1);
+
+    first.remove(j1);
+    REQUIRE(first.empty());
+    REQUIRE_FALSE(decltype(first)::linked(j1));
+
+    REQUIRE(&second.remove_back() == &j2);
+    REQUIRE(second.empty());
+
+    REQUIRE(sl::check_active<sl::Throwing>::value);
+    REQUIRE_FALSE(sl::check_active<sl::Unchecked>::value);
+}
+
+TEST_CASE("Node check policy", "[node_check]") {
+    sl::Node<int, sl::Throwing> n1(1);
+    sl::Node<int, sl::Throwing> n2(2);
+
+    REQUIRE_THROWS_AS(n1.next(), std::logic_error);
+    REQUIRE_THROWS_AS(n1.prev(), std::logic_error);
+    REQUIRE_THROWS_AS(n1.next(n1), std::logic_error);
+
+    n1.next(n2);
+    n2.prev(n1);
+    REQUIRE(n1.next() == n2);
+    REQUIRE(n2.prev() == n1);
+
+    sl::Node<int, sl::Throwing> n4(4);
+    REQUIRE_NOTHROW(n1.append_next(n4));
+    REQUIRE(n1.next() == n4);
+    REQUIRE(n4.next() == n2);
+
+    sl::Node<int, sl::Unchecked> n3(3);
+    n3.next(n3);
+    REQUIRE(n3.next() == n3);
+
+#if defined(SIMPLE_LIST_CHECK)
+    REQUIRE(std::is_same<sl::DefaultCheck, SIMPLE_LIST_CHECK>::value);
+#elif defined(NDEBUG)
+    REQUIRE(std::is_same<sl::DefaultCheck, sl::Unchecked>::value);
+#else
+    REQUIRE(std::is_same<sl::DefaultCheck, sl::Asserting>::value);
+#endif
+}
+
+TEST_CASE("List visitors", "[l_visitors]") {
+    sl::UnorderedList<int> list;
+    std::vector<sl::Node<int>> nodes;
+
+    for (int i = 1; i <= 10; i++) {
+        nodes.emplace_back(i);
+    }
+
+    for (auto &node : nodes) {
+        list.add_back(node);
+    }
+
+    int calls = 0;
+    list.apply([&calls](sl::Node<int> &node) {
+        node.value() *= 2;
+        calls++;
+    });
+    REQUIRE(calls == 10);
+    REQUIRE(list.last().value() == 20);
+
+    auto *stop = list.for_each_until([](sl::Node<int> &node) { return node.value() > 7; });
+    REQUIRE(stop == &nodes[3]);
+    REQUIRE(list.for_each_until([](sl::Node<int> &) { return false; }) == nullptr);
+
+    const int limit = 11;
+    REQUIRE(list.find_if([limit](int v) { return v > limit; }) == &nodes[5]);
+    REQUIRE(list.find_if([](int v) { return v % 2 == 1; }) == nullptr);
+    REQUIRE(list.any_of([](int v) { return v == 20; }));
+    REQUIRE_FALSE(list.any_of([](int v) { return v == 21; }));
+
+    REQUIRE(list.fold(0, [](int acc, int v) { return acc + v; }) == 110);
+    REQUIRE(list.fold(std::string(), [](std::string acc, int v) {
+        return acc + std::to_string(v / 2);
+    }) == "12345678910");
+
+    // The visited node can be unlinked.
+    list.apply([&list](sl::Node<int> &node) {
+        if (node.value() % 4 == 0) {
+            list.remove(node);
+        }
+    });
+    REQUIRE(list.size() == 5);
+    REQUIRE(list.fold(0, [](int acc, int v) { return acc + v; }) == 50);
+
+    sl::UnorderedList<int> empty;
+    REQUIRE(empty.fold(7, [](int acc, int v) { return acc + v; }) == 7);
+    REQUIRE_FALSE(empty.any_of([](int) { return true; }));
+}
+
+TEST_CASE("List iterators", "[l_iterators]") {
+    using It = sl::UnorderedList<int>::iterator;
+    static_assert(std::is_same<std::iterator_traits<It>::iterator_category,
+            std::bidirectional_iterator_tag>::value, "bidirectional");
+    static_assert(sizeof(It) == sizeof(void *), "a node pointer");
+
+    sl::UnorderedList<int> list;
+    REQUIRE(list.begin() == list.end());
+    REQUIRE(list.rbegin() == list.rend());
+
+    int values[] = {3, 1, 4, 1, 5};
+    auto *owned = sl::UnorderedList<int>::create_from_array(values, 5);
+
+    int sum = 0;
+    for (int v : *owned) {
+        sum += v;
+    }
+    REQUIRE(sum == 14);
+    REQUIRE(std::accumulate(owned->begin(), owned->end(), 0) == 14);
+    REQUIRE(std::distance(owned->begin(), owned->end()) == 5);
+    REQUIRE(std::vector<int>(owned->rbegin(), owned->rend()) == std::vector<int>({5, 1, 4, 1, 3}));
+    REQUIRE(*std::prev(owned->end()) == 5);
+
+    auto it = std::find_if(owned->begin(), owned->end(), [](int v) { return v > 3; });
+    REQUIRE(*it == 4);
+    REQUIRE(&it.node() == &owned->first().next().next());
+    *it = 9;
+    REQUIRE(owned->first().next().next().value() == 9);
+    REQUIRE(*it-- == 9);
+    REQUIRE(*it == 1);
+
+    std::replace(owned->begin(), owned->end(), 1, 2);
+    const sl::UnorderedList<int> &view = *owned;
+    sl::UnorderedList<int>::const_iterator cit = owned->begin();
+    REQUIRE(cit == view.begin());
+    REQUIRE(std::count(view.cbegin(), view.cend(), 2) == 2);
+    REQUIRE(std::accumulate(view.rbegin(), view.rend(), 0) == 21);
+
+    sl::OrderedList<std::string> ordered;
+    ordered.emplace("b");
+    ordered.emplace("c");
+    ordered.emplace("a");
+    REQUIRE(std::is_sorted(ordered.begin(), ordered.end()));
+    REQUIRE(ordered.begin()->size() == 1);
+    REQUIRE(*ordered.rbegin() == "c");
+
+    delete owned;
+}
+
+TEST_CASE("List parallel_apply", "[l_parallel_apply]") {
+    sl::ThreadPool pool(4);
+
+    for (const int size : {0, 1, 3, 16, 1000, 20011}) {
+        sl::UnorderedList<int64_t> list;
+
+        for (int i = 0; i < size; i++) {
+            list.emplace_back(i);
+        }
+
+        list.parallel_apply(pool, [](sl::Node<int64_t> &node) { node.value() = node.value() * 3 + 1; });
+
+        int64_t expected = 0;
+        int wrong = 0;
+        for (const int64_t v : list) {
+            wrong += v == expected * 3 + 1 ? 0 : 1;
+            expected++;
+        }
+
+        REQUIRE(wrong == 0);
+        REQUIRE(expected == size);
+    }
+
+    sl::UnorderedList<int> list;
+    for (int i = 0; i < 100; i++) {
+        list.emplace_back(i);
+    }
+
+    // The segments of the first call are reused, until the links change.
+    const auto increment = [](sl::Node<int> &node) { node.value()++; };
+    list.parallel_apply(pool, increment);
+    list.parallel_apply(pool, increment);
+    REQUIRE(list.fold(0, std::plus<int>()) == 4950 + 200);
+
+    list.remove_front();
+    list.emplace_back(1000);
+    list.parallel_apply(pool, increment);
+    REQUIRE(list.fold(0, std::plus<int>()) == 4950 + 200 - 2 + 1000 + 100);
+    REQUIRE(list.first().value() == 4);
+
+    REQUIRE_THROWS_AS(list.parallel_apply(pool, [](sl::Node<int> &node) {
+        if (node.value() == 50) {
+            throw std::runtime_error("fail");
+        }
+    }), std::runtime_error);
+}
+
+TEST_CASE("List parallel_reduce", "[l_parallel_reduce]") {
+    sl::ThreadPool pool(3);
+
+    for (const int size : {0, 1, 2, 12, 997, 30000}) {
+        sl::OrderedList<int64_t> list;
+
+        for (int i = size - 1; i >= 0; i--) {
+            list.emplace(i);
+        }
+
+        const int64_t sum = list.parallel_reduce(pool, 5, [](int64_t a, int64_t b) { return a + b; });
+        REQUIRE(sum == 5 + static_cast<int64_t>(size) * (size - 1) / 2);
+    }
+
+    // Associative but not commutative: the order of the values is kept.
+    sl::UnorderedList<std::string> words;
+    std::string expected = ">";
+
+    for (int i = 0; i < 500; i++) {
+        words.emplace_back(std::to_string(i % 10));
+        expected += std::to_string(i % 10);
+    }
+
+    REQUIRE(words.parallel_reduce(pool, ">", [](const std::string &a, const std::string &b) {
+        return a + b;
+    }) == expected);
+}
+
+TEST_CASE("List apply_prefetched", "[l_prefetch]") {
+    sl::UnorderedList<int64_t> list;
+
+    for (int64_t i = 0; i < 100; i++) {
+        list.emplace_back(i);
+    }
+
+    // The first call walks the list and builds the table, the second uses it.
+    for (int pass = 0; pass < 2; pass++) {
+        std::vector<int64_t> values;
+        list.apply_prefetched([&values](sl::Node<int64_t> &node) { values.push_back(node.value()); });
+
+        REQUIRE(values.size() == 100);
+        REQUIRE(std::is_sorted(values.begin(), values.end()));
+    }
+
+    // Remove by index with a valid table keeps it valid.
+    REQUIRE(list.remove(10)->value() == 10);
+    REQUIRE(list.remove(0)->value() == 0);
+    REQUIRE(list.remove(97)->value() == 99);
+
+    int64_t sum = 0;
+    list.apply_prefetched([&sum](sl::Node<int64_t> &node) { sum += node.value(); });
+    REQUIRE(sum == 4950 - 10 - 0 - 99);
+
+    // A change not tracked by the table invalidates it.
+    list.emplace_front(1000);
+    sl::Node<int64_t> *first = nullptr;
+    list.apply_prefetched<2>([&first](sl::Node<int64_t> &node) {
+        if (first == nullptr) {
+            first = &node;
+        }
+    });
+    REQUIRE(first == &list.first());
+    REQUIRE(first->value() == 1000);
+
+    // The distance can be larger than the list.
+    sum = 0;
+    list.apply_prefetched<1000>([&sum](sl::Node<int64_t> &node) { sum += node.value(); });
+    REQUIRE(sum == 4950 - 10 - 0 - 99 + 1000);
+
+    // The ordered list keeps the table sorted on add and remove_value.
+    sl::OrderedList<int> ordered;
+
+    for (int i = 0; i < 50; i++) {
+        ordered.emplace((i * 7) % 50);
+    }
+
+    ordered.apply_prefetched([](sl::Node<int> &) {});
+
+    sl::Node<int> low(-1);
+    sl::Node<int> mid(25);
+    sl::Node<int> high(100);
+    ordered.add(high);
+    ordered.add(low);
+    ordered.add(mid);
+
+    REQUIRE(ordered.remove_value(42)->value() == 42);
+    REQUIRE(ordered.remove_value(42) == nullptr);
+    REQUIRE(ordered.remove_value(25) != nullptr);
+    REQUIRE(ordered.remove_value(25) != nullptr);
+    REQUIRE(ordered.remove_value(25) == nullptr);
+    REQUIRE(ordered.size() == 50);
+
+    std::vector<int> walked(ordered.cbegin(), ordered.cend());
+    std::vector<int> prefetched;
+    ordered.apply_prefetched([&prefetched](sl::Node<int> &node) { prefetched.push_back(node.value()); });
+
+    REQUIRE(std::is_sorted(walked.begin(), walked.end()));
+    REQUIRE(prefetched == walked);
+    REQUIRE(walked.front() == -1);
+    REQUIRE(walked.back() == 100);
+}
+
+TEST_CASE("List static interface", "[l_static]") {
+    static_assert(std::is_base_of<sl::List<int>, sl::UnorderedList<int>>::value, "the virtual interface is kept");
+    static_assert(std::is_base_of<sl::ListBase<sl::OrderedList<int>, int>, sl::OrderedList<int>>::value,
+                  "the static interface is a base");
+
+    std::vector<sl::Node<int>> nodes(6);
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        nodes[i].value(static_cast<int>(i * 7 % 6));
+    }
+
+    sl::UnorderedList<int> unordered;
+    sl::ListBase<sl::UnorderedList<int>, int> &unordered_base = unordered;
+
+    for (auto &node : nodes) {
+        unordered_base.push(node);
+    }
+
+    REQUIRE(&unordered_base.derived() == &unordered);
+    REQUIRE(unordered.first().value() == nodes[0].value());
+    REQUIRE(unordered.last().value() == nodes[5].value());
+    REQUIRE(drain(unordered) == 15);
+    REQUIRE(unordered.empty());
+
+    sl::OrderedList<int> ordered;
+    sl::ListBase<sl::OrderedList<int>, int> &ordered_base = ordered;
+    sl::List<int> &virtual_base = ordered;
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (i % 2 == 0) {
+            ordered_base.push(nodes[i]);
+        } else {
+            virtual_base.add(nodes[i]);
+        }
+    }
+
+    REQUIRE(ordered.size() == 6);
+    REQUIRE(ordered_base.pop_front().value() == 0);
+    REQUIRE(virtual_base.remove_front().value() == 1);
+    REQUIRE(drain(ordered) == 2 + 3 + 4 + 5);
+
+    // push is bound to UnorderedList::add, the override is reached only through
+    // the virtual interface.
+    CountingAddList counting;
+    sl::ListBase<sl::UnorderedList<int>, int> &counting_base = counting;
+    sl::List<int> &counting_virtual = counting;
+
+    counting_base.push(nodes[0]);
+    REQUIRE(counting.adds == 0);
+    counting_virtual.add(nodes[1]);
+    REQUIRE(counting.adds == 1);
+    REQUIRE(counting.size() == 2);
+    REQUIRE(drain(counting) == nodes[0].value() + nodes[1].value());
+}
+
+namespace {
+
+    template<typename L, typename = void>
+    struct has_transform_values : std::false_type {
+    };
+
+    template<typename L>
+    struct has_transform_values<L, decltype(std::declval<L &>().transform_values(std::negate<int32_t>()), void())>
+            : std::true_type {
+    };
+
+} // namespace
+
+TEST_CASE("List block kernels", "[l_kernels]") {
+    // Transforming the values would break the order of an OrderedList.
+    static_assert(has_transform_values<sl::UnorderedList<int32_t>>::value, "unordered lists transform values");
+    static_assert(!has_transform_values<sl::OrderedList<int32_t>>::value, "ordered lists keep their order");
+
+    // Sizes around the block size, so that full, partial and empty blocks and
+    // the tails of the lanes are all covered.
+    for (const int size : {1, 7, 256, 257, 1000}) {
+        sl::UnorderedList<int32_t> list;
+        std::vector<int32_t> values;
+
+        for (int i = 0; i < size; i++) {
+            const int32_t value = (i * 37) % 101 - 50;
+            list.emplace_back(value);
+            values.push_back(value * 3 + 1);
+        }
+
+        list.transform_values([](int32_t v) { return v * 3 + 1; });
+
+        REQUIRE(std::vector<int32_t>(list.cbegin(), list.cend()) == values);
+        REQUIRE(list.sum() == std::accumulate(values.begin(), values.end(), 0));
+        REQUIRE(list.min() == *std::min_element(values.begin(), values.end()));
+        REQUIRE(list.max() == *std::max_element(values.begin(), values.end()));
+        REQUIRE(list.count_if([](int32_t v) { return v > 0; }) ==
+                static_cast<size_t>(std::count_if(values.begin(), values.end(), [](int32_t v) { return v > 0; })));
+    }
+
+    sl::OrderedList<double> doubles;
+
+    for (int i = 0; i < 600; i++) {
+        doubles.emplace((i % 2 == 0 ? 1 : -1) * static_cast<double>(i) / 4);
+    }
+
+    REQUIRE(doubles.min() == Approx(-599.0 / 4));
+    REQUIRE(doubles.max() == Approx(598.0 / 4));
+    REQUIRE(doubles.sum() == Approx(-300.0 / 4));
+    REQUIRE(doubles.count_if([](double v) { return v < 0; }) == 300);
+
+    sl::UnorderedList<float> floats;
+
+    for (int i = 0; i < 300; i++) {
+        floats.emplace_back(static_cast<float>(i % 17));
+    }
+
+    floats.transform_values([](float v) { return v < 8 ? v : 8.0f; });
+    REQUIRE(floats.max() == 8.0f);
+    REQUIRE(floats.min() == 0.0f);
+
+    // The same values gathered through the table of jump pointers.
+    floats.apply_prefetched([](sl::Node<float> &) {});
+    floats.transform_values([](float v) { return v * 2; });
+    REQUIRE(floats.max() == 16.0f);
+    REQUIRE(floats.sum() == Approx(std::accumulate(floats.cbegin(), floats.cend(), 0.0f)));
+    // 9 values from 8 to 16 in each of the 17 full rounds, and 8, 9, 10 after.
+    REQUIRE(floats.count_if([](float v) { return v == 16.0f; }) == 17 * 9 + 3);
+
+    sl::UnorderedList<int64_t> empty;
+    REQUIRE(empty.sum() == 0);
+    REQUIRE(empty.count_if([](int64_t) { return true; }) == 0);
+    empty.transform_values([](int64_t v) { return v + 1; });
+    REQUIRE(empty.empty());
+}
+
+TEST_CASE("List contiguous export", "[l_export]") {
+    sl::UnorderedList<int> list;
+    list.reserve(1000);
+
+    for (int i = 0; i < 1000; i++) {
+        list.emplace_back(i);
+    }
+
+    const std::vector<int> values = list.to_vector();
+    REQUIRE(values.size() == 1000);
+    REQUIRE(values.front() == 0);
+    REQUIRE(values.back() == 999);
+
+    std::vector<int> copied(1000);
+    REQUIRE(list.copy_values_to(copied.data()) == copied.data() + copied.size());
+    REQUIRE(copied == values);
+
+    // The nodes were reserved, so the values are viewed in place.
+    auto view = list.values_view();
+    REQUIRE(view.size() == 1000);
+    REQUIRE(&view[0] == &list.first().value());
+    REQUIRE(view.stride() == sizeof(sl::Node<int>));
+    REQUIRE(view[999] == 999);
+    REQUIRE(std::vector<int>(view.begin(), view.end()) == values);
+
+    view[3] = 42;
+    REQUIRE(list.first().next().next().next().value() == 42);
+
+    const sl::UnorderedList<int> &constant = list;
+    REQUIRE(constant.values_view().size() == 1000);
+    REQUIRE(constant.values_view()[3] == 42);
+
+    // Moving a node breaks the layout.
+    list.move_to_front(list.last());
+    REQUIRE(list.values_view().empty());
+    REQUIRE(list.values_view().begin() == list.values_view().end());
+
+    sl::UnorderedList<int> empty;
+    REQUIRE(empty.to_vector().empty());
+    REQUIRE(empty.values_view().empty());
+}
+
+TEST_CASE("UnorderedList assign_from", "[ul_assign]") {
+    sl::UnorderedList<int> list;
+    list.enable_index();
+
+    for (int i = 0; i < 5; i++) {
+        list.emplace_back(i);
+    }
+
+    const sl::Node<int> *first = &list.first();
+    const int grow[] = {10, 11, 12, 13, 14, 15, 16, 17};
+
+    // The nodes are reused and the missing ones created.
+    list.assign_from(grow, 8);
+    REQUIRE(list.size() == 8);
+    REQUIRE(&list.first() == first);
+    REQUIRE(list.to_vector() == std::vector<int>(grow, grow + 8));
+    REQUIRE(list.find(12) != nullptr);
+    REQUIRE(list.find(2) == nullptr);
+
+    const int shrink[] = {7, 8, 9};
+    list.assign_from(shrink, 3);
+    REQUIRE(list.size() == 3);
+    REQUIRE(&list.first() == first);
+    REQUIRE(list.to_vector() == std::vector<int>(shrink, shrink + 3));
+    REQUIRE(list.find(9) == &list.last());
+    REQUIRE(list.find(15) == nullptr);
+
+    list.assign_from(nullptr, 0);
+    REQUIRE(list.empty());
+
+    // A list of nodes that it doesn't own gives them back unlinked.
+    sl::UnorderedList<int> borrowed;
+    sl::Node<int> a(1);
+    sl::Node<int> b(2);
+    borrowed.add_back(a);
+    borrowed.add_back(b);
+
+    borrowed.assign_from(shrink, 1);
+    REQUIRE(borrowed.size() == 1);
+    REQUIRE(a.value() == 7);
+    REQUIRE_FALSE(b.has_next());
+}
+
+TEST_CASE("List save and load", "[l_file]") {
+    const std::string path = "simple_list_test.bin";
+
+    std::vector<int32_t> values(10000);
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = static_cast<int32_t>((i * 7919) % 10007) - 5000;
+    }
+
+    sl::OrderedList<int32_t> *ordered = sl::OrderedList<int32_t>::create_from_array(values.data(), values.size());
+    REQUIRE(ordered->save(path));
+
+    sl::OrderedList<int32_t> *loaded = sl::OrderedList<int32_t>::load(path);
+    REQUIRE(loaded != nullptr);
+    REQUIRE(loaded->size() == ordered->size());
+    REQUIRE(loaded->to_vector() == ordered->to_vector());
+    REQUIRE(loaded->values_view().size() == values.size());
+
+    // The values of another type or out of order are rejected.
+    REQUIRE(sl::OrderedList<int64_t>::load(path) == nullptr);
+    REQUIRE(sl::UnorderedList<uint32_t>::load(path) == nullptr);
+
+    sl::UnorderedList<int32_t> *unordered = sl::UnorderedList<int32_t>::create_from_array(values.data(), values.size());
+    REQUIRE(unordered->save(path));
+    REQUIRE(sl::OrderedList<int32_t>::load(path) == nullptr);
+
+    sl::UnorderedList<int32_t> *reloaded = sl::UnorderedList<int32_t>::load(path);
+    REQUIRE(reloaded != nullptr);
+    REQUIRE(reloaded->to_vector() == values);
+
+    // A truncated file is rejected.
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 2));
+    }
+
+    REQUIRE(sl::UnorderedList<int32_t>::load(path) == nullptr);
+
+    // A header that claims far more values than the file holds is rejected
+    // before any node is reserved.
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        const uint64_t count = 0x7ffffff0;
+        file.seekp(16);
+        file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    }
+
+    REQUIRE(sl::UnorderedList<int32_t>::load(path) == nullptr);
+
+    // A file of the other byte order is swapped back.
+    {
+        const char big_endian[] = {'S', 'L', 'S', 'T', 0, 2, 'i', 0, 1, 2, 3, 4, 0, 0, 0, 4,
+                                   0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0};
+        const char little_endian[] = {'S', 'L', 'S', 'T', 2, 0, 'i', 0, 4, 3, 2, 1, 4, 0, 0, 0,
+                                      3, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0};
+        const uint32_t order = 0x01020304;
+        const bool big = *reinterpret_cast<const char *>(&order) == 1;
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(big ? little_endian : big_endian, sizeof(big_endian));
+    }
+
+    sl::OrderedList<int32_t> *swapped = sl::OrderedList<int32_t>::load(path);
+    REQUIRE(swapped != nullptr);
+    REQUIRE(swapped->to_vector() == std::vector<int32_t>{1, 256, 65536});
+
+    sl::UnorderedList<double> empty;
+    REQUIRE(empty.save(path));
+    sl::UnorderedList<double> *none = sl::UnorderedList<double>::load(path);
+    REQUIRE(none != nullptr);
+    REQUIRE(none->empty());
+
+    REQUIRE(sl::UnorderedList<double>::load("no/such/file.bin") == nullptr);
+    REQUIRE_FALSE(empty.save("no/such/file.bin"));
+
+    // Values larger than a byte can count are saved with their full size.
+    sl::OrderedList<Record> records;
+    for (int32_t i = 0; i < 10; i++) {
+        Record record{};
+        record.key = (i * 7) % 10;
+        record.payload[195] = static_cast<char>(200 + i);
+        records.emplace(record);
+    }
+
+    REQUIRE(records.save(path));
+    sl::OrderedList<Record> *loaded_records = sl::OrderedList<Record>::load(path);
+    REQUIRE(loaded_records != nullptr);
+    REQUIRE(loaded_records->size() == 10);
+    REQUIRE(loaded_records->last().value().key == 9);
+    REQUIRE(loaded_records->last().value().payload[195] == records.last().value().payload[195]);
+    delete loaded_records;
+
+    // Only the ordered lists need operator< to load.
+    sl::UnorderedList<Point> points;
+    points.emplace_back(Point{1, 2});
+    points.emplace_back(Point{-3, 4});
+    REQUIRE(points.save(path));
+    sl::UnorderedList<Point> *loaded_points = sl::UnorderedList<Point>::load(path);
+    REQUIRE(loaded_points != nullptr);
+    REQUIRE(loaded_points->size() == 2);
+    REQUIRE(loaded_points->last().value().x == -3);
+    REQUIRE(loaded_points->last().value().y == 4);
+    delete loaded_points;
+
+    std::remove(path.c_str());
+    delete ordered;
+    delete loaded;
+    delete unordered;
+    delete reloaded;
+    delete swapped;
+    delete none;
+}
+
+TEST_CASE("MappedList", "[ml_mapped]") {
+    const std::string path = "simple_list_mapped.bin";
+    std::remove(path.c_str());
+
+    sl::MappedList<int64_t> *list = sl::MappedList<int64_t>::open(path, 4);
+    REQUIRE(list != nullptr);
+    REQUIRE(list->empty());
+    REQUIRE(list->capacity() == 4);
+
+    // More values than slots: the file grows and is mapped again.
+    for (int64_t i = 0; i < 100; i++) {
+        REQUIRE(list->add_back(i));
+    }
+
+    REQUIRE(list->capacity() == 128);
+    REQUIRE(list->remove_front() == 0);
+    REQUIRE(list->remove_back() == 99);
+    REQUIRE(list->add_front(-1));
+    REQUIRE(list->remove_value(50));
+    REQUIRE_FALSE(list->remove_value(50));
+    REQUIRE(list->sync());
+    delete list;
+
+    // Reopened, maybe at another address, without loading.
+    list = sl::MappedList<int64_t>::open(path);
+    REQUIRE(list != nullptr);
+    REQUIRE(list->size() == 98);
+    REQUIRE(list->front() == -1);
+    REQUIRE(list->back() == 98);
+
+    std::vector<int64_t> expected{-1};
+    for (int64_t i = 1; i < 99; i++) {
+        if (i != 50) {
+            expected.push_back(i);
+        }
+    }
+    REQUIRE(list->to_vector() == expected);
+
+    // A second mapping of the same file is at another address, the links are
+    // offsets so it reads the same list.
+    sl::MappedList<int64_t> *other = sl::MappedList<int64_t>::open(path);
+    REQUIRE(other != nullptr);
+    REQUIRE(other->to_vector() == expected);
+    delete other;
+
+    // The freed slots are reused before the unused ones.
+    while (!list->empty()) {
+        list->remove_front();
+    }
+
+    for (const int64_t value : {5, 1, 4, 1, 3, 9}) {
+        REQUIRE(list->add(value));
+    }
+
+    REQUIRE(list->to_vector() == std::vector<int64_t>{1, 1, 3, 4, 5, 9});
+    REQUIRE(list->capacity() == 128);
+    delete list;
+
+    REQUIRE(sl::MappedList<int32_t>::open(path) == nullptr);
+    REQUIRE(sl::MappedList<int32_t>::open("no/such/file.bin") == nullptr);
+
+    // A new file is written aside and renamed, and an empty file, like one
+    // left by a crash, is created again.
+    std::remove(path.c_str());
+    {
+        std::ofstream touch(path);
+    }
+
+    list = sl::MappedList<int64_t>::open(path, 8);
+    REQUIRE(list != nullptr);
+    REQUIRE(list->empty());
+    REQUIRE(list->capacity() == 8);
+    REQUIRE(list->add_back(1));
+    delete list;
+    REQUIRE_FALSE(std::ifstream(path + ".tmp").good());
+
+    // The size of the values is kept whole: 304 bytes don't pass for 48.
+    struct Page {
+        int32_t key;
+        char bytes[300];
+    };
+
+    struct Small {
+        char bytes[48];
+    };
+
+    std::remove(path.c_str());
+    sl::MappedList<Page> *pages = sl::MappedList<Page>::open(path, 2);
+    REQUIRE(pages != nullptr);
+    Page page{};
+    page.key = 3;
+    page.bytes[299] = 'p';
+    REQUIRE(pages->add_back(page));
+    delete pages;
+
+    REQUIRE(sl::MappedList<Small>::open(path) == nullptr);
+    pages = sl::MappedList<Page>::open(path);
+    REQUIRE(pages != nullptr);
+    REQUIRE(pages->front().key == 3);
+    REQUIRE(pages->front().bytes[299] == 'p');
+    delete pages;
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("List mutation log", "[l_log]") {
+    const std::string path = "simple_list_test.log";
+    std::remove(path.c_str());
+
+    sl::UnorderedList<int32_t> unordered;
+    sl::MutationLog<int32_t> *log = sl::MutationLog<int32_t>::open(path, 4);
+    REQUIRE(log != nullptr);
+    unordered.log_to(log);
+
+    for (int32_t i = 0; i < 10; i++) {
+        unordered.emplace_back(i);
+    }
+
+    // A group is committed every 4 records.
+    REQUIRE(log->pending() == 2);
+
+    unordered.emplace_front(-1);
+    unordered.remove_front();
+    unordered.remove_back();
+    unordered.remove(3);
+    REQUIRE(unordered.remove(unordered.size()) == nullptr);
+    unordered.remove_value(7);
+    REQUIRE(unordered.remove_value(100) == nullptr);
+    unordered.add_front(unordered.remove_back());
+
+    // Assigning reuses the nodes, and is logged as a whole.
+    const int32_t shorter[] = {5, 6, 7};
+    unordered.assign_from(shorter, 3);
+    const int32_t longer[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    unordered.assign_from(longer, 12);
+    unordered.remove_front();
+    REQUIRE(log->commit());
+    REQUIRE(log->pending() == 0);
+
+    std::vector<int32_t> expected = unordered.to_vector();
+    unordered.log_to(nullptr);
+    unordered.emplace_back(42);
+
+    sl::UnorderedList<int32_t> replayed;
+    REQUIRE(replayed.replay(path));
+    REQUIRE(replayed.to_vector() == expected);
+
+    // A group torn by a crash is ignored, and cut when the log is opened.
+    unordered.log_to(log);
+    unordered.emplace_back(50);
+    REQUIRE(log->pending() == 1);
+    delete log;
+
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        out.write("\x0a\x00\x00\x00\x01\x02", 6);
+    }
+
+    expected.push_back(50);
+    sl::UnorderedList<int32_t> torn;
+    REQUIRE(torn.replay(path));
+    REQUIRE(torn.to_vector() == expected);
+
+    log = sl::MutationLog<int32_t>::open(path);
+    REQUIRE(log != nullptr);
+    unordered.log_to(log);
+    unordered.emplace_front(60);
+    REQUIRE(log->commit());
+    unordered.log_to(nullptr);
+    delete log;
+
+    expected.insert(expected.begin(), 60);
+    sl::UnorderedList<int32_t> reopened;
+    REQUIRE(reopened.replay(path));
+    REQUIRE(reopened.to_vector() == expected);
+
+    // The index finds any node with a value, the log still removes the same
+    // one on replay, even if the replayed list has its own index.
+    std::remove(path.c_str());
+    log = sl::MutationLog<int32_t>::open(path);
+    sl::UnorderedList<int32_t> indexed;
+    indexed.enable_index();
+    indexed.log_to(log);
+    indexed.emplace_back(5);
+    indexed.emplace_front(1);
+    indexed.emplace_front(5);
+    REQUIRE(indexed.remove_value(5) != nullptr);
+    indexed.log_to(nullptr);
+    delete log;
+
+    for (const bool index : {false, true}) {
+        sl::UnorderedList<int32_t> redone;
+
+        if (index) {
+            redone.enable_index();
+        }
+
+        REQUIRE(redone.replay(path));
+        REQUIRE(redone.to_vector() == indexed.to_vector());
+    }
+
+    // The log is redone on the snapshot it was started from.
+    sl::OrderedList<int32_t> ordered;
+    for (int32_t i = 0; i < 100; i++) {
+        ordered.emplace((i * 37) % 100);
+    }
+
+    REQUIRE(ordered.save("simple_list_test.bin"));
+    std::remove(path.c_str());
+    log = sl::MutationLog<int32_t>::open(path, 1000);
+    ordered.log_to(log);
+
+    for (int32_t i = 0; i < 50; i++) {
+        ordered.emplace(i * 3);
+        ordered.remove_value(i * 2);
+    }
+
+    ordered.remove_front();
+    ordered.log_to(nullptr);
+    delete log;
+
+    sl::OrderedList<int32_t> *restored = sl::OrderedList<int32_t>::load("simple_list_test.bin");
+    REQUIRE(restored != nullptr);
+    REQUIRE(restored->replay(path));
+    REQUIRE(restored->to_vector() == ordered.to_vector());
+
+    // The log of an UnorderedList doesn't fit an OrderedList, and the values
+    // must be of the type of the list.
+    std::remove(path.c_str());
+    log = sl::MutationLog<int32_t>::open(path);
+    unordered.log_to(log);
+    unordered.emplace_front(1);
+    unordered.log_to(nullptr);
+    delete log;
+
+    sl::OrderedList<int32_t> mismatch;
+    REQUIRE_FALSE(mismatch.replay(path));
+    sl::UnorderedList<int64_t> other;
+    REQUIRE_FALSE(other.replay(path));
+    REQUIRE(sl::MutationLog<int64_t>::open(path) == nullptr);
+    REQUIRE_FALSE(other.replay("no/such/file.log"));
+
+    // Values larger than a byte can count are logged with their full size.
+    std::remove(path.c_str());
+    sl::MutationLog<Record> *records = sl::MutationLog<Record>::open(path);
+    REQUIRE(records != nullptr);
+    Record record{};
+    record.key = 7;
+    record.payload[195] = 'z';
+    records->record_value(sl::LogOp::AddBack, record);
+    delete records;
+
+    int32_t visited = 0;
+    REQUIRE(sl::MutationLog<Record>::read(path, [&visited](sl::LogOp op, const Record &value, int32_t) {
+        visited += op == sl::LogOp::AddBack && value.key == 7 && value.payload[195] == 'z' ? 1 : 0;
+        return true;
+    }));
+    REQUIRE(visited == 1);
+
+    std::remove(path.c_str());
+    std::remove("simple_list_test.bin");
+    delete restored;
+}
+
+TEST_CASE("SharedList", "[sl_shared]") {
+    const std::string name = "/simple_list_test_" + std::to_string(getpid());
+    std::unique_ptr<sl::SharedList<int64_t>> list(sl::SharedList<int64_t>::create(name, 64));
+    REQUIRE(list != nullptr);
+    REQUIRE(list->empty());
+    REQUIRE(list->capacity() == 64);
+    REQUIRE(sl::SharedList<int64_t>::create(name, 64) == nullptr);
+    REQUIRE(sl::SharedList<int32_t>::open(name) == nullptr);
+
+    // A second mapping of the segment sees the same list.
+    std::unique_ptr<sl::SharedList<int64_t>> other(sl::SharedList<int64_t>::open(name));
+    REQUIRE(other != nullptr);
+    REQUIRE(list->add_back(1));
+    REQUIRE(list->add_back(2));
+    REQUIRE(other->to_vector() == std::vector<int64_t>{1, 2});
+
+    int64_t value = 0;
+    REQUIRE(other->remove_front(value));
+    REQUIRE(value == 1);
+    REQUIRE(list->size() == 1);
+
+    // The list doesn't grow: the values past the capacity are refused.
+    std::vector<int64_t> batch(100);
+    std::iota(batch.begin(), batch.end(), 0);
+    REQUIRE(list->add_back(batch.data(), batch.size()) == 63);
+    REQUIRE_FALSE(list->add_back(100));
+
+    std::vector<int64_t> removed(10);
+    REQUIRE(other->remove_front(removed.data(), removed.size()) == 10);
+    REQUIRE(removed[0] == 2);
+    REQUIRE(removed[9] == 8);
+
+    int64_t sum = 0;
+    REQUIRE(other->consume_front(1000, [&sum](const int64_t &v) { sum += v; }) == 54);
+    REQUIRE(sum == std::accumulate(batch.begin() + 9, batch.begin() + 63, int64_t(0)));
+    REQUIRE(list->empty());
+    REQUIRE_FALSE(list->remove_front(value));
+    REQUIRE_FALSE(list->wait(1));
+
+    // A child process produces, this one consumes.
+    const int64_t count = 10000;
+    const pid_t child = fork();
+    REQUIRE(child >= 0);
+
+    if (child == 0) {
+        std::unique_ptr<sl::SharedList<int64_t>> producer(sl::SharedList<int64_t>::open(name));
+
+        for (int64_t i = 0; producer && i < count;) {
+            i += producer->add_back(i) ? 1 : 0;
+        }
+
+        _exit(producer ? 0 : 1);
+    }
+
+    int64_t expected = 0;
+    bool ordered = true;
+
+    while (expected < count && list->wait(5000)) {
+        list->consume_front(64, [&](const int64_t &v) { ordered = ordered && v == expected++; });
+    }
+
+    int status = 0;
+    waitpid(child, &status, 0);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+    REQUIRE(expected == count);
+    REQUIRE(ordered);
+
+    // A process that dies holding the lock is taken over, and the list is
+    // rebuilt from its forward ring: the value it was reading is still there.
+    REQUIRE(list->add_back(7));
+    using Shared = sl::OffsetList<int64_t>;
+    const auto die_in = [&name](auto damage) {
+        const pid_t pid = fork();
+
+        if (pid == 0) {
+            std::unique_ptr<sl::SharedList<int64_t>> consumer(sl::SharedList<int64_t>::open(name));
+
+            consumer->consume_front(1, [&damage](const int64_t &v) {
+                const char *held = reinterpret_cast<const char *>(&v) - offsetof(Shared::Slot, value);
+                auto &slot = *reinterpret_cast<Shared::Slot *>(const_cast<char *>(held));
+                // The slot is the first, so its previous links are the sentinel.
+                char *sentinel = reinterpret_cast<char *>(&slot.links) + slot.links.prev;
+
+                damage(slot, *reinterpret_cast<Shared::Header *>(sentinel - offsetof(Shared::Header, sentinel)));
+                _exit(0);
+            });
+            _exit(1);
+        }
+
+        int died = 0;
+        waitpid(pid, &died, 0);
+
+        return WIFEXITED(died) && WEXITSTATUS(died) == 0;
+    };
+
+    REQUIRE(die_in([](Shared::Slot &, Shared::Header &) {}));
+    REQUIRE(list->to_vector() == std::vector<int64_t>{7});
+
+    REQUIRE(die_in([](Shared::Slot &slot, Shared::Header &) { slot.links.prev = 8; }));
+    REQUIRE(list->to_vector() == std::vector<int64_t>{7});
+    REQUIRE(list->size() == 1);
+
+    // A slot out of the ring and off the free list, like one being released,
+    // is leaked until the list is rebuilt: then every slot can be filled again.
+    REQUIRE(die_in([](Shared::Slot &, Shared::Header &header) {
+        header.sentinel.next = 0;
+        header.sentinel.prev = 0;
+    }));
+    REQUIRE(list->empty());
+    REQUIRE(list->add_back(batch.data(), batch.size()) == 64);
+    REQUIRE(other->remove_front(removed.data(), removed.size()) == 10);
+    REQUIRE(other->consume_front(1000, [](const int64_t &) {}) == 54);
+    REQUIRE(list->add_back(7));
+
+    // A damaged forward ring can't be rebuilt: the segment is broken, and every
+    // operation fails.
+    REQUIRE(die_in([](Shared::Slot &slot, Shared::Header &) { slot.links.next = 8; }));
+    REQUIRE(list->size() == 0);
+    REQUIRE(other->empty());
+    REQUIRE_FALSE(list->add_back(8));
+    REQUIRE_FALSE(other->remove_front(value));
+    REQUIRE_FALSE(list->wait(1));
+    REQUIRE(list->to_vector().empty());
+
+    REQUIRE(sl::SharedList<int64_t>::destroy(name));
+    REQUIRE_FALSE(sl::SharedList<int64_t>::destroy(name));
+    REQUIRE(sl::SharedList<int64_t>::open(name) == nullptr);
+}
+
+namespace {
+
+    /**
+     * @brief A resource that counts the memory it hands out.
+     */
+    class CountingResource : public sl::MemoryResource {
+    public:
+        size_t allocated{0};
+        size_t outstanding{0};
+
+    private:
+        void *do_allocate(size_t bytes, size_t alignment) override {
+            allocated += bytes;
+            outstanding += bytes;
+
+            return sl::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void *pointer, size_t bytes, size_t alignment) override {
+            outstanding -= bytes;
+            sl::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+    };
+
+}
+
+TEST_CASE("List memory resources", "[l_resource]") {
+    std::vector<int32_t> values(1000);
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = static_cast<int32_t>((i * 7919) % 1009);
+    }
+
+    std::vector<int32_t> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    sl::UnorderedList<int32_t> plain;
+    REQUIRE(plain.resource() == sl::new_delete_resource());
+    REQUIRE(sl::new_delete_resource()->is_equal(*sl::new_delete_resource()));
+
+    CountingResource counting;
+    {
+        sl::UnorderedList<int32_t> list(&counting);
+        REQUIRE(list.resource() == &counting);
+
+        for (const int32_t value : values) {
+            list.emplace_back(value);
+        }
+
+        REQUIRE(list.to_vector() == values);
+        REQUIRE(counting.outstanding > 0);
+
+        sl::OrderedList<int32_t> *ordered = sl::OrderedList<int32_t>::create_from_array(values.data(), values.size(),
+                                                                                         &counting);
+        REQUIRE(ordered->to_vector() == sorted);
+        ordered->emplace(-1);
+        REQUIRE(ordered->first().value() == -1);
+        delete ordered;
+    }
+
+    REQUIRE(counting.allocated > 0);
+    REQUIRE(counting.outstanding == 0);
+    REQUIRE_FALSE(counting.is_equal(*sl::new_delete_resource()));
+
+    // An arena that starts on the stack and then takes blocks from upstream.
+    alignas(std::max_align_t) char buffer[1024];
+    sl::MonotonicBuffer arena(buffer, sizeof(buffer), &counting);
+    {
+        sl::UnorderedList<int32_t> *list = sl::UnorderedList<int32_t>::create_from_array(values.data(), values.size(),
+                                                                                          &arena);
+        REQUIRE(list->to_vector() == values);
+        REQUIRE(arena.upstream_bytes() > 0);
+        REQUIRE(counting.outstanding == arena.upstream_bytes());
+
+        for (int32_t i = 0; i < 500; i++) {
+            list->remove_front();
+        }
+
+        REQUIRE(list->size() == 500);
+        delete list;
+    }
+
+    arena.release();
+    REQUIRE(arena.upstream_bytes() == 0);
+    REQUIRE(counting.outstanding == 0);
+
+    sl::MonotonicBuffer small(1);
+    void *a = small.allocate(3, 1);
+    void *b = small.allocate(8, 8);
+    REQUIRE(a != b);
+    REQUIRE(reinterpret_cast<uintptr_t>(b) % 8 == 0);
+
+    // A standard allocator adapted to a resource.
+    sl::AllocatorResource<std::allocator<int32_t>> adapted;
+    sl::AllocatorResource<std::allocator<char>> other;
+    REQUIRE(adapted.is_equal(sl::AllocatorResource<std::allocator<int32_t>>()));
+    REQUIRE_FALSE(adapted.is_equal(other));
+
+    sl::OrderedList<int32_t> *ordered = sl::OrderedList<int32_t>::create_from_array(values.data(), values.size(),
+                                                                                     &adapted);
+    REQUIRE(ordered->to_vector() == sorted);
+    REQUIRE(ordered->remove_value(sorted[10]) != nullptr);
+    delete ordered;
+
+    sl::OrderedList<int32_t> *none = sl::OrderedList<int32_t>::create_from_array(values.data(), 0, &adapted);
+    REQUIRE(none->empty());
+    delete none;
+
+    // The parallel build takes its nodes from the resource too.
+    sl::ThreadPool pool(3);
+    {
+        std::unique_ptr<sl::OrderedList<int32_t>> parallel(
+                sl::OrderedList<int32_t>::create_from_array(values.data(), values.size(), pool, &counting));
+        REQUIRE(parallel->to_vector() == sorted);
+        REQUIRE(parallel->resource() == &counting);
+        REQUIRE(counting.outstanding > 0);
+    }
+
+    REQUIRE(counting.outstanding == 0);
+}